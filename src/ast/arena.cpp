@@ -0,0 +1,26 @@
+#include "arena.hpp"
+
+#include <cstdint>
+
+void* Arena::allocate(size_t size, size_t alignment) {
+    size_t padding = (alignment - reinterpret_cast<uintptr_t>(this->current) % alignment) % alignment;
+
+    if(this->current == nullptr || padding + size > this->remaining) {
+        // Blok boyutundan büyük istekler kendi bloklarını alır
+        size_t blockSize = size + alignment > BLOCK_SIZE ? size + alignment : BLOCK_SIZE;
+        this->blocks.push_back(std::make_unique<char[]>(blockSize));
+        this->current = this->blocks.back().get();
+        this->remaining = blockSize;
+        padding = (alignment - reinterpret_cast<uintptr_t>(this->current) % alignment) % alignment;
+    }
+
+    void* result = this->current + padding;
+    this->current += padding + size;
+    this->remaining -= padding + size;
+    this->used += size;
+    return result;
+}
+
+size_t Arena::bytesUsed() const {
+    return this->used;
+}
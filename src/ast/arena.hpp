@@ -0,0 +1,48 @@
+#ifndef ARENA_HPP
+#define ARENA_HPP
+
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <utility>
+#include <vector>
+
+// AST düğümleri için bölge (bump) ayırıcı. Düğümler ayrıştırma sırasıyla
+// büyük bloklara art arda yerleştirilir, böylece bir alt ağaç bellekte bitişik
+// durur. Bellek tek tek değil, Arena yok edildiğinde topluca serbest bırakılır.
+class Arena {
+public:
+    Arena() = default;
+    Arena(const Arena&) = delete;
+    Arena& operator=(const Arena&) = delete;
+
+    void* allocate(size_t size, size_t alignment);
+    size_t bytesUsed() const;
+
+private:
+    static constexpr size_t BLOCK_SIZE = 64 * 1024;
+
+    std::vector<std::unique_ptr<char[]>> blocks;
+    char* current = nullptr;
+    size_t remaining = 0;
+    size_t used = 0;
+};
+
+// Arena'daki düğümün yalnızca yıkıcısını çağırır; belleği Arena geri verir
+struct NodeDeleter {
+    template<typename T>
+    void operator()(T* node) const {
+        node->~T();
+    }
+};
+
+template<typename T>
+using NodePtr = std::unique_ptr<T, NodeDeleter>;
+
+template<typename T, typename... Args>
+NodePtr<T> makeNode(Arena& arena, Args&&... args) {
+    void* memory = arena.allocate(sizeof(T), alignof(T));
+    return NodePtr<T>(new (memory) T(std::forward<Args>(args)...));
+}
+
+#endif // ARENA_HPP
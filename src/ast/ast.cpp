@@ -1,36 +1,91 @@
 #include "ast.hpp"
 
+#include <stdexcept>
+
+Operator toOperator(TokenType type, bool isUnary) {
+    switch(type) {
+    case TokenType::PLUS:
+        return Operator::ADD;
+    case TokenType::MINUS:
+        return isUnary ? Operator::NEGATE : Operator::SUBTRACT;
+    case TokenType::MULTIPLY:
+        return Operator::MULTIPLY;
+    case TokenType::DIVIDE:
+        return Operator::DIVIDE;
+    case TokenType::MODULUS:
+        return Operator::MODULUS;
+    case TokenType::POWER:
+        return Operator::POWER;
+    case TokenType::AND:
+        return Operator::AND;
+    case TokenType::OR:
+        return Operator::OR;
+    case TokenType::BANG:
+        return Operator::NOT;
+    case TokenType::GREAT:
+        return Operator::GREAT;
+    case TokenType::GREAT_EQUAL:
+        return Operator::GREAT_EQUAL;
+    case TokenType::LESS:
+        return Operator::LESS;
+    case TokenType::LESS_EQUAL:
+        return Operator::LESS_EQUAL;
+    case TokenType::EQUAL_EQUAL:
+        return Operator::EQUAL;
+    case TokenType::BANG_EQUAL:
+        return Operator::NOT_EQUAL;
+    default:
+        throw std::runtime_error("Geçersiz işlem operatörü.");
+    }
+}
+
+ValueType toValueType(TokenType type, bool isArray) {
+    if(isArray)
+        return ValueType::ARRAY;
+
+    switch(type) {
+    case TokenType::TYPE_NUMBER:
+        return ValueType::NUMBER;
+    case TokenType::TYPE_STRING:
+        return ValueType::STRING;
+    case TokenType::TYPE_BOOL:
+        return ValueType::BOOL;
+    default:
+        throw std::runtime_error("Geçersiz tip.");
+    }
+}
+
 //Expression Implementasyonları
-BinaryExpression::BinaryExpression(const Token& op, std::unique_ptr<Expression> left, std::unique_ptr<Expression> right)
-    : op(op), left(std::move(left)), right(std::move(right)) {}
+BinaryExpression::BinaryExpression(const Token& op, NodePtr<Expression> left, NodePtr<Expression> right)
+    : op(op), operation(toOperator(op.type)), left(std::move(left)), right(std::move(right)) {}
 
 void BinaryExpression::accept(ASTVisitor& visitor) {
     visitor.visitBinaryExpression(this);
 }
 
-LogicalExpression::LogicalExpression(const Token& op, std::unique_ptr<Expression> left, std::unique_ptr<Expression> right)
-    : op(op), left(std::move(left)), right(std::move(right)) {}
+LogicalExpression::LogicalExpression(const Token& op, NodePtr<Expression> left, NodePtr<Expression> right)
+    : op(op), operation(toOperator(op.type)), left(std::move(left)), right(std::move(right)) {}
 
 void LogicalExpression::accept(ASTVisitor& visitor) {
     visitor.visitLogicalExpression(this);
 }
 
-UnaryExpression::UnaryExpression(const Token& op, std::unique_ptr<Expression> operand)
-    : op(op), operand(std::move(operand)) {}
+UnaryExpression::UnaryExpression(const Token& op, NodePtr<Expression> operand)
+    : op(op), operation(toOperator(op.type, true)), operand(std::move(operand)) {}
 
 void UnaryExpression::accept(ASTVisitor& visitor) {
     visitor.visitUnaryExpression(this);
 }
 
-ComparisonExpression::ComparisonExpression(const Token& op, std::unique_ptr<Expression> left, std::unique_ptr<Expression> right)
-    : op(op), left(std::move(left)), right(std::move(right)) {}
+ComparisonExpression::ComparisonExpression(const Token& op, NodePtr<Expression> left, NodePtr<Expression> right)
+    : op(op), operation(toOperator(op.type)), left(std::move(left)), right(std::move(right)) {}
 
 void ComparisonExpression::accept(ASTVisitor& visitor) {
     visitor.visitComparisonExpression(this);
 }
 
-LiteralExpression::LiteralExpression(const Token& token)
-    : token(token), value(token.start, token.length) {}
+LiteralExpression::LiteralExpression(const Token& token, Value value)
+    : token(token), value(std::move(value)) {}
 
 void LiteralExpression::accept(ASTVisitor& visitor) {
     visitor.visitLiteralExpression(this);
@@ -43,51 +98,54 @@ void VariableExpression::accept(ASTVisitor& visitor) {
     visitor.visitVariableExpression(this);
 }
 
-AssignExpression::AssignExpression(const Token& name, std::unique_ptr<Expression> value)
+AssignExpression::AssignExpression(const Token& name, NodePtr<Expression> value)
     : name(name), value(std::move(value)) {}
 
 void AssignExpression::accept(ASTVisitor& visitor) {
     visitor.visitAssignExpression(this);
 }
 
-CallExpression::CallExpression(std::unique_ptr<Expression> callee, const Token& paren, std::vector<std::unique_ptr<Expression>> arguments)
-    : callee(std::move(callee)), arguments(std::move(arguments)), line(paren.line), column(paren.column) {}
+CallExpression::CallExpression(NodePtr<Expression> callee, const Token& paren, std::vector<NodePtr<Expression>> arguments)
+    : callee(std::move(callee)), paren(paren), arguments(std::move(arguments)) {}
 
 void CallExpression::accept(ASTVisitor& visitor) {
     visitor.visitCallExpression(this);
 }
 
-ArrayExpression::ArrayExpression(std::vector<std::unique_ptr<Expression>> elements, const Token& bracket)
-    : elements(std::move(elements)), line(bracket.line), column(bracket.column) {}
+ArrayExpression::ArrayExpression(std::vector<NodePtr<Expression>> elements, const Token& bracket)
+    : elements(std::move(elements)), bracket(bracket) {}
 
 void ArrayExpression::accept(ASTVisitor& visitor) {
     visitor.visitArrayExpression(this);
 }
 
-ArrayAccessExpression::ArrayAccessExpression(std::unique_ptr<Expression> array,
-    std::unique_ptr<Expression> index,
+ArrayAccessExpression::ArrayAccessExpression(NodePtr<Expression> array,
+    NodePtr<Expression> index,
     const Token& bracket)
-    : array(std::move(array)), index(std::move(index)), line(bracket.line), column(bracket.column) {}
+    : array(std::move(array)), index(std::move(index)), bracket(bracket) {}
 
 void ArrayAccessExpression::accept(ASTVisitor& visitor) {
     visitor.visitArrayAccessExpression(this);
 }
 
-ArrayAssignExpression::ArrayAssignExpression(std::unique_ptr<Expression> array, std::unique_ptr<Expression> index,
-        std::unique_ptr<Expression> value)
-        : array(std::move(array)), index(std::move(index)), value(std::move(value)) {}
+ArrayAssignExpression::ArrayAssignExpression(const Token& name, std::vector<NodePtr<Expression>> indices,
+        const Token& op, NodePtr<Expression> value)
+        : name(name), indices(std::move(indices)), op(op), isCompound(op.type != TokenType::EQUAL),
+          operation(isCompound ? toOperator(op.type) : Operator::ADD), value(std::move(value)) {}
 
-void ArrayAssignExpression::accept(ASTVisitor& visitor) {}
+void ArrayAssignExpression::accept(ASTVisitor& visitor) {
+    visitor.visitArrayAssignExpression(this);
+}
 
 // Statements implementasyonları
-ExpressionStmt::ExpressionStmt(std::unique_ptr<Expression> expression)
+ExpressionStmt::ExpressionStmt(NodePtr<Expression> expression)
     : expression(std::move(expression)) {}
 
 void ExpressionStmt::accept(ASTVisitor& visitor) {
     visitor.visitExpressionStmt(this);
 }
 
-PrintStmt::PrintStmt(std::unique_ptr<Expression> expression)
+PrintStmt::PrintStmt(NodePtr<Expression> expression)
     : expression(std::move(expression)) {}
 
 void PrintStmt::accept(ASTVisitor& visitor) {
@@ -95,30 +153,31 @@ void PrintStmt::accept(ASTVisitor& visitor) {
 }
 
 VarDeclStmt::VarDeclStmt(const Token& name, const Token& type, bool isArray, bool isConst,
-    std::unique_ptr<Expression> initializer)
-    : name(name), type(type), isArray(isArray), isConst(isConst), initializer(std::move(initializer)) {}
+    NodePtr<Expression> initializer)
+    : name(name), type(type), isArray(isArray), isConst(isConst), valueType(toValueType(type.type, isArray)),
+      initializer(std::move(initializer)) {}
 
 void VarDeclStmt::accept(ASTVisitor& visitor) {
     visitor.visitVarDeclStmt(this);
 }
 
-BlockStmt::BlockStmt(std::vector<std::unique_ptr<Stmt>> statements)
+BlockStmt::BlockStmt(std::vector<NodePtr<Stmt>> statements)
     : statements(std::move(statements)) {}
 
 void BlockStmt::accept(ASTVisitor& visitor) {
     visitor.visitBlockStmt(this);
 }
 
-IfStmt::IfStmt(std::unique_ptr<Expression> condition,
-    std::unique_ptr<Stmt> thenBranch,
-    std::unique_ptr<Stmt> elseBranch)
+IfStmt::IfStmt(NodePtr<Expression> condition,
+    NodePtr<Stmt> thenBranch,
+    NodePtr<Stmt> elseBranch)
     : condition(std::move(condition)), thenBranch(std::move(thenBranch)), elseBranch(std::move(elseBranch)) {}
 
 void IfStmt::accept(ASTVisitor& visitor) {
     visitor.visitIfStmt(this);
 }
 
-LoopStmt::LoopStmt(std::unique_ptr<Expression> condition, std::unique_ptr<Stmt> body)
+LoopStmt::LoopStmt(NodePtr<Expression> condition, NodePtr<Stmt> body)
     : condition(std::move(condition)), body(std::move(body)) {}
 
 void LoopStmt::accept(ASTVisitor& visitor) {
@@ -142,23 +201,24 @@ void ContinueStmt::accept(ASTVisitor& visitor) {
 FunctionDeclStmt::FunctionDeclStmt(const Token& name, const Token& returnType,
     std::vector<Token> paramNames,
     std::vector<Token> paramTypes,
-    std::unique_ptr<BlockStmt> body)
+    std::vector<ValueType> paramValueTypes,
+    NodePtr<BlockStmt> body)
     : name(name), returnType(returnType), paramNames(std::move(paramNames)),
-      paramTypes(std::move(paramTypes)), body(std::move(body)) {}
+      paramTypes(std::move(paramTypes)), paramValueTypes(std::move(paramValueTypes)), body(std::move(body)) {}
 
 void FunctionDeclStmt::accept(ASTVisitor& visitor) {
     visitor.visitFunctionDeclStmt(this);
 }
 
-ReturnStmt::ReturnStmt(const Token& keyword, std::unique_ptr<Expression> value)
+ReturnStmt::ReturnStmt(const Token& keyword, NodePtr<Expression> value)
     : keyword(keyword), value(std::move(value)) {}
 
 void ReturnStmt::accept(ASTVisitor& visitor) {
     visitor.visitReturnStmt(this);
 }
 
-Program::Program(std::vector<std::unique_ptr<Stmt>> statements)
-    : statements(std::move(statements)) {}
+Program::Program(std::unique_ptr<Arena> arena, std::vector<NodePtr<Stmt>> statements)
+    : arena(std::move(arena)), statements(std::move(statements)) {}
 
 void Program::accept(ASTVisitor& visitor) {
     visitor.visitProgram(this);
@@ -2,11 +2,16 @@
 #define AST_H
 
 #include <memory>
+#include <string>
 #include <vector>
 
+#include "arena.hpp"
 #include "../token/token.hpp"
+#include "../interpreter/value.hpp"
 
 class ASTVisitor;
+class FunctionDeclStmt;
+struct Builtin;
 
 class AstNode {
 public:
@@ -17,57 +22,100 @@ public:
 class Expression : public AstNode {};
 class Stmt : public AstNode {};
 
+// Ayrıştırma sırasında token tipinden çözülen işlem türü
+enum class Operator {
+    ADD,                          // +
+    SUBTRACT,                     // -
+    MULTIPLY,                     // *
+    DIVIDE,                       // /
+    MODULUS,                      // %
+    POWER,                        // **
+
+    AND,                          // &&
+    OR,                           // ||
+
+    NEGATE,                       // - (tekli)
+    NOT,                          // !
+
+    GREAT,                        // >
+    GREAT_EQUAL,                  // >=
+    LESS,                         // <
+    LESS_EQUAL,                   // <=
+    EQUAL,                        // ==
+    NOT_EQUAL                     // !=
+};
+
+Operator toOperator(TokenType type, bool isUnary = false);
+
+// Ayrıştırma sırasında tip token'ından çözülen değer tipi
+enum class ValueType : uint8_t {
+    NUMBER,                       // sayı
+    STRING,                       // metin
+    BOOL,                         // doğruluk
+    ARRAY                         // sayı[], metin[], doğruluk[]
+};
+
+ValueType toValueType(TokenType type, bool isArray = false);
+
 class BinaryExpression : public Expression {
 public:
     Token op;
-    std::unique_ptr<Expression> left;
-    std::unique_ptr<Expression> right;
+    Operator operation;
+    NodePtr<Expression> left;
+    NodePtr<Expression> right;
 
-    BinaryExpression(const Token& op, std::unique_ptr<Expression> left, std::unique_ptr<Expression> right);
+    BinaryExpression(const Token& op, NodePtr<Expression> left, NodePtr<Expression> right);
     void accept(ASTVisitor& visitor) override;
 };
 
 class LogicalExpression : public Expression {
 public:
     Token op;
-    std::unique_ptr<Expression> left;
-    std::unique_ptr<Expression> right;
+    Operator operation;
+    NodePtr<Expression> left;
+    NodePtr<Expression> right;
 
-    LogicalExpression(const Token& op, std::unique_ptr<Expression> left, std::unique_ptr<Expression> right);
+    LogicalExpression(const Token& op, NodePtr<Expression> left, NodePtr<Expression> right);
     void accept(ASTVisitor& visitor) override;
 };
 
 class UnaryExpression : public Expression {
 public:
     Token op;
-    std::unique_ptr<Expression> operand;
+    Operator operation;
+    NodePtr<Expression> operand;
 
-    UnaryExpression(const Token& op, std::unique_ptr<Expression> operand);
+    UnaryExpression(const Token& op, NodePtr<Expression> operand);
     void accept(ASTVisitor& visitor) override;
 };
 
 class ComparisonExpression : public Expression {
 public:
     Token op;
-    std::unique_ptr<Expression> left;
-    std::unique_ptr<Expression> right;
+    Operator operation;
+    NodePtr<Expression> left;
+    NodePtr<Expression> right;
 
-    ComparisonExpression(const Token& op, std::unique_ptr<Expression> left, std::unique_ptr<Expression> right);
+    ComparisonExpression(const Token& op, NodePtr<Expression> left, NodePtr<Expression> right);
     void accept(ASTVisitor& visitor) override;
 };
 
 class LiteralExpression : public Expression {
 public:
     Token token;
-    const std::string value;
+    Value value; // Ayrıştırma sırasında bir kez oluşturulan sabit değer
 
-    explicit LiteralExpression(const Token& token);
+    LiteralExpression(const Token& token, Value value);
     void accept(ASTVisitor& visitor) override;
 };
 
 class VariableExpression : public Expression {
 public:
     Token name;
+    // Resolver tarafından doldurulur: depth < 0 ise slot global indeksidir,
+    // değilse kaç çevre yukarıdaki yerel slot olduğu
+    int depth = -1;
+    unsigned int slot = 0;
 
     explicit VariableExpression(const Token& name);
     void accept(ASTVisitor& visitor) override;
@@ -76,70 +124,81 @@ public:
 class AssignExpression : public Expression {
 public:
     Token name;
-    std::unique_ptr<Expression> value;
+    int depth = -1;
+    unsigned int slot = 0;
+    NodePtr<Expression> value;
 
-    AssignExpression(const Token& name, std::unique_ptr<Expression> value);
+    AssignExpression(const Token& name, NodePtr<Expression> value);
     void accept(ASTVisitor& visitor) override;
 };
 
 class CallExpression : public Expression {
 public:
-    std::unique_ptr<Expression> callee;
-    unsigned int line;
-    unsigned int column;
-    std::vector<std::unique_ptr<Expression>> arguments;
-
-    CallExpression(std::unique_ptr<Expression> callee, const Token& paren,
-        std::vector<std::unique_ptr<Expression>> arguments);
+    NodePtr<Expression> callee;
+    Token paren;
+    std::vector<NodePtr<Expression>> arguments;
+    // Resolver'ın bağladığı fonksiyon; derinlik -1 ise global fonksiyon tablosundaki indeks
+    bool isBound = false; // Çağrılan ifade bir isim değilse false kalır
+    int depth = -1;
+    unsigned int slot = 0;
+    const Builtin* builtin = nullptr; // Global fonksiyon tanımsızsa çağrılan yerleşik fonksiyon
+
+    CallExpression(NodePtr<Expression> callee, const Token& paren,
+        std::vector<NodePtr<Expression>> arguments);
     void accept(ASTVisitor& visitor) override;
 };
 
 class ArrayExpression : public Expression {
 public:
-    std::vector<std::unique_ptr<Expression>> elements;
-    unsigned int line;
-    unsigned int column;
+    std::vector<NodePtr<Expression>> elements;
+    Token bracket;
 
-    ArrayExpression(std::vector<std::unique_ptr<Expression>> elements, const Token& bracket);
+    ArrayExpression(std::vector<NodePtr<Expression>> elements, const Token& bracket);
     void accept(ASTVisitor& visitor) override;
 };
 
 class ArrayAccessExpression : public Expression {
 public:
-    std::unique_ptr<Expression> array;
-    std::unique_ptr<Expression> index;
-    unsigned int line;
-    unsigned int column;
+    NodePtr<Expression> array;
+    NodePtr<Expression> index;
+    Token bracket;
 
-    ArrayAccessExpression(std::unique_ptr<Expression> array, std::unique_ptr<Expression> index,
+    ArrayAccessExpression(NodePtr<Expression> array, NodePtr<Expression> index,
         const Token& bracket);
     void accept(ASTVisitor& visitor) override;
 };
 
+// a[i][j] = v biçimindeki atama. Hedef zinciri ayrıştırıcıda kök değişkene
+// ve kökten başlayan indeks listesine açılır, eleman yerinde değiştirilir.
 class ArrayAssignExpression : public Expression {
 public:
-    std::unique_ptr<Expression> array;
-    std::unique_ptr<Expression> index;
-    std::unique_ptr<Expression> value;
-
-    ArrayAssignExpression(std::unique_ptr<Expression> array, std::unique_ptr<Expression> index,
-        std::unique_ptr<Expression> value);
+    Token name;
+    int depth = -1;
+    unsigned int slot = 0;
+    std::vector<NodePtr<Expression>> indices;
+    Token op;             // Düz atamada '=', bileşik atamada temel işlem token'ı
+    bool isCompound;
+    Operator operation;   // Yalnızca bileşik atamada anlamlı
+    NodePtr<Expression> value;
+
+    ArrayAssignExpression(const Token& name, std::vector<NodePtr<Expression>> indices,
+        const Token& op, NodePtr<Expression> value);
     void accept(ASTVisitor& visitor) override;
 };
 
 class ExpressionStmt : public Stmt {
 public:
-    std::unique_ptr<Expression> expression;
+    NodePtr<Expression> expression;
 
-    explicit ExpressionStmt(std::unique_ptr<Expression> expression);
+    explicit ExpressionStmt(NodePtr<Expression> expression);
     void accept(ASTVisitor& visitor) override;
 };
 
 class PrintStmt : public Stmt {
 public:
-    std::unique_ptr<Expression> expression;
+    NodePtr<Expression> expression;
 
-    explicit PrintStmt(std::unique_ptr<Expression> expression);
+    explicit PrintStmt(NodePtr<Expression> expression);
     void accept(ASTVisitor& visitor) override;
 };
 
@@ -149,40 +208,46 @@ public:
     Token type;
     bool isArray;
     bool isConst;
+    ValueType valueType; // Tip token'ından çözülür, diziler ARRAY olur
+    int depth = -1; // Global tanımlarda -1, yerel tanımlarda 0
+    unsigned int slot = 0;
 
-    std::unique_ptr<Expression> initializer;
+    NodePtr<Expression> initializer;
 
     VarDeclStmt(const Token& name, const Token& type, bool isArray, bool isConst,
-        std::unique_ptr<Expression> initializer);
+        NodePtr<Expression> initializer);
     void accept(ASTVisitor& visitor) override;
 };
 
 class BlockStmt : public Stmt {
 public:
-    std::vector<std::unique_ptr<Stmt>> statements;
+    std::vector<NodePtr<Stmt>> statements;
+    unsigned int slotCount = 0; // Blokta tanımlanan yerel değişken sayısı
+    unsigned int functionCount = 0; // Blokta tanımlanan yerel fonksiyon sayısı
+    std::vector<FunctionDeclStmt*> functions; // Resolver'ın blok başına taşıdığı fonksiyonlar
 
-    explicit BlockStmt(std::vector<std::unique_ptr<Stmt>> statements);
+    explicit BlockStmt(std::vector<NodePtr<Stmt>> statements);
     void accept(ASTVisitor& visitor) override;
 };
 
 class IfStmt : public Stmt {
 public:
-    std::unique_ptr<Expression> condition;
-    std::unique_ptr<Stmt> thenBranch;
-    std::unique_ptr<Stmt> elseBranch;
+    NodePtr<Expression> condition;
+    NodePtr<Stmt> thenBranch;
+    NodePtr<Stmt> elseBranch;
 
-    IfStmt(std::unique_ptr<Expression> condition,
-        std::unique_ptr<Stmt> thenBranch,
-        std::unique_ptr<Stmt> elseBlock);
+    IfStmt(NodePtr<Expression> condition,
+        NodePtr<Stmt> thenBranch,
+        NodePtr<Stmt> elseBlock);
     void accept(ASTVisitor& visitor) override;
 };
 
 class LoopStmt : public Stmt {
 public:
-    std::unique_ptr<Expression> condition;
-    std::unique_ptr<Stmt> body;
+    NodePtr<Expression> condition;
+    NodePtr<Stmt> body;
 
-    LoopStmt(std::unique_ptr<Expression> condition, std::unique_ptr<Stmt> body);
+    LoopStmt(NodePtr<Expression> condition, NodePtr<Stmt> body);
     void accept(ASTVisitor& visitor) override;
 };
 
@@ -208,29 +273,40 @@ public:
     Token returnType;
     std::vector<Token> paramNames;
     std::vector<Token> paramTypes;
-    std::unique_ptr<BlockStmt> body;
+    std::vector<ValueType> paramValueTypes; // Dizi parametreleri ARRAY olarak çözülür
+    NodePtr<BlockStmt> body;
+    int depth = -1; // Global tanımlarda -1, yerel tanımlarda 0
+    unsigned int slot = 0;
+    bool isHoisted = false; // Bloğa girilirken tanımlanır, deyim çalışınca bir şey yapılmaz
 
     FunctionDeclStmt(const Token& name, const Token& returnType,
         std::vector<Token> paramNames,
         std::vector<Token> paramTypes,
-        std::unique_ptr<BlockStmt> body);
+        std::vector<ValueType> paramValueTypes,
+        NodePtr<BlockStmt> body);
     void accept(ASTVisitor& visitor) override;
 };
 
 class ReturnStmt : public Stmt {
 public:
     Token keyword;
-    std::unique_ptr<Expression> value;
+    NodePtr<Expression> value;
+    FunctionDeclStmt* function = nullptr; // Resolver tarafından bağlanan kapsayan fonksiyon
 
-    ReturnStmt(const Token& keyword, std::unique_ptr<Expression> value);
+    ReturnStmt(const Token& keyword, NodePtr<Expression> value);
     void accept(ASTVisitor& visitor) override;
 };
 
+// Program tüm düğümlerin bulunduğu Arena'ya sahiptir. Arena ilk üye olduğu
+// için en son yok edilir; düğümlerin yıkıcıları bellek geri verilmeden önce çalışır.
 class Program : public AstNode {
 public:
-    std::vector<std::unique_ptr<Stmt>> statements;
+    std::unique_ptr<Arena> arena;
+    std::vector<NodePtr<Stmt>> statements;
+    std::vector<Symbol> globalSymbols; // Resolver'ın atadığı global indeksler
+    std::vector<Symbol> globalFunctionSymbols; // Resolver'ın atadığı global fonksiyon indeksleri
 
-    explicit Program(std::vector<std::unique_ptr<Stmt>> statements);
+    Program(std::unique_ptr<Arena> arena, std::vector<NodePtr<Stmt>> statements);
     void accept(ASTVisitor& visitor) override;
 };
 
@@ -248,7 +324,7 @@ public:
     virtual void visitCallExpression(CallExpression* expr) = 0;
     virtual void visitArrayExpression(ArrayExpression* expr) = 0;
     virtual void visitArrayAccessExpression(ArrayAccessExpression* expr) = 0;
-    //virtual void visitArrayAssignExpression(ArrayAssignExpression* expr) = 0;
+    virtual void visitArrayAssignExpression(ArrayAssignExpression* expr) = 0;
 
     virtual void visitExpressionStmt(ExpressionStmt* stmt) = 0;
     virtual void visitPrintStmt(PrintStmt* stmt) = 0;
@@ -26,7 +26,7 @@ void ASTPrinter::printNode(const std::string& name, const std::string& details)
 
 // Visitor Metotaları
 void ASTPrinter::visitBinaryExpression(BinaryExpression* expr) {
-    std::string op(expr->op.start, expr->op.length);
+    std::string op(expr->op.lexeme());
     this->printNode("İkili ifade", "İşlem: " + op);
 
     this->indentLevel++;
@@ -43,7 +43,7 @@ void ASTPrinter::visitBinaryExpression(BinaryExpression* expr) {
 }
 
 void ASTPrinter::visitLogicalExpression(LogicalExpression* expr) {
-    std::string op(expr->op.start, expr->op.length);
+    std::string op(expr->op.lexeme());
     this->printNode("Mantıksal İfade", "İşlem: " + op);
 
     this->indentLevel++;
@@ -60,7 +60,7 @@ void ASTPrinter::visitLogicalExpression(LogicalExpression* expr) {
 }
 
 void ASTPrinter::visitUnaryExpression(UnaryExpression* expr) {
-    std::string op(expr->op.start, expr->op.length);
+    std::string op(expr->op.lexeme());
     this->printNode("Tekli İfade", "İşlem: " + op);
 
     this->indentLevel++;
@@ -69,7 +69,7 @@ void ASTPrinter::visitUnaryExpression(UnaryExpression* expr) {
 }
 
 void ASTPrinter::visitComparisonExpression(ComparisonExpression* expr) {
-    std::string op(expr->op.start, expr->op.length);
+    std::string op(expr->op.lexeme());
     this->printNode("Karşılaştırma İfadesi", "İşlem: " + op);
 
     this->indentLevel++;
@@ -86,7 +86,7 @@ void ASTPrinter::visitComparisonExpression(ComparisonExpression* expr) {
 }
 
 void ASTPrinter::visitLiteralExpression(LiteralExpression* expr) {
-    std::string value = expr->value;
+    std::string value(expr->token.lexeme());
     std::string type;
 
     switch(expr->token.type) {
@@ -108,12 +108,12 @@ void ASTPrinter::visitLiteralExpression(LiteralExpression* expr) {
 }
 
 void ASTPrinter::visitVariableExpression(VariableExpression* expr) {
-    std::string name(expr->name.start, expr->name.length);
+    std::string name(expr->name.lexeme());
     this->printNode("Değişken", "İsim: " + name);
 }
 
 void ASTPrinter::visitAssignExpression(AssignExpression* expr) {
-    std::string name(expr->name.start, expr->name.length);
+    std::string name(expr->name.lexeme());
     this->printNode("Atama İfadesi", "Hedef: " + name);
 
     this->indentLevel++;
@@ -178,6 +178,25 @@ void ASTPrinter::visitArrayAccessExpression(ArrayAccessExpression* expr) {
     this->indentLevel--;
 }
 
+void ASTPrinter::visitArrayAssignExpression(ArrayAssignExpression* expr) {
+    std::string name(expr->name.lexeme());
+    this->printNode("Dizi Elemanına Atama", "Hedef: " + name);
+
+    this->indentLevel++;
+    for(auto& index : expr->indices) {
+        std::cout << this->getIndent() << "indeks" << std::endl;
+        this->indentLevel++;
+        index->accept(*this);
+        this->indentLevel--;
+    }
+
+    std::cout << this->getIndent() << "Değer:" << std::endl;
+    this->indentLevel++;
+    expr->value->accept(*this);
+    this->indentLevel--;
+    this->indentLevel--;
+}
+
 void ASTPrinter::visitExpressionStmt(ExpressionStmt* stmt) {
     this->printNode("İfade Deyimi");
 
@@ -195,8 +214,8 @@ void ASTPrinter::visitPrintStmt(PrintStmt* stmt) {
 }
 
 void ASTPrinter::visitVarDeclStmt(VarDeclStmt* stmt) {
-    std::string name(stmt->name.start, stmt->name.length);
-    std::string type(stmt->type.start, stmt->type.length);
+    std::string name(stmt->name.lexeme());
+    std::string type(stmt->type.lexeme());
     std::string kind = stmt->isConst ? "sbt" : "deg";
 
     std::string details = "İsim: " + name + ", Tip: " + type;
@@ -276,11 +295,11 @@ void ASTPrinter::visitContinueStmt(ContinueStmt* stmt) {
 }
 
 void ASTPrinter::visitFunctionDeclStmt(FunctionDeclStmt* stmt) {
-    std::string name(stmt->name.start, stmt->name.length);
+    std::string name(stmt->name.lexeme());
 
     std::string returnTypeName;
     if(stmt->returnType.type != TokenType::TOKEN_EOF)
-        returnTypeName = std::string(stmt->returnType.start, stmt->returnType.length);
+        returnTypeName = std::string(stmt->returnType.lexeme());
     else
         returnTypeName = "void";
 
@@ -297,8 +316,10 @@ void ASTPrinter::visitFunctionDeclStmt(FunctionDeclStmt* stmt) {
         this->indentLevel++;
 
         for(unsigned int i=0; i<stmt->paramNames.size(); i++) {
-            std::string paramName(stmt->paramNames[i].start, stmt->paramNames[i].length);
-            std::string paramType(stmt->paramTypes[i].start, stmt->paramTypes[i].length);
+            std::string paramName(stmt->paramNames[i].lexeme());
+            std::string paramType(stmt->paramTypes[i].lexeme());
+            if(stmt->paramValueTypes[i] == ValueType::ARRAY)
+                paramType += "[]";
 
             this->printNode("Parametre", "İsim: " + paramName + ", Tip: " + paramType);
         }
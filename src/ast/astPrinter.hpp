@@ -27,6 +27,7 @@ private:
     void visitCallExpression(CallExpression* expr) override;
     void visitArrayExpression(ArrayExpression* expr) override;
     void visitArrayAccessExpression(ArrayAccessExpression* expr) override;
+    void visitArrayAssignExpression(ArrayAssignExpression* expr) override;
 
     void visitExpressionStmt(ExpressionStmt* stmt) override;
     void visitPrintStmt(PrintStmt* stmt) override;
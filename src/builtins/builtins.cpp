@@ -0,0 +1,204 @@
+#include "builtins.hpp"
+
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+    #define BUILTINS_SSE2 1
+    #include <emmintrin.h>
+#endif
+
+// Çekirdekler SSE2 ile ikişer double üzerinde, kalan elemanlar skaler
+// işlenir. Toplama ve iç çarpım iki ayrı akümülatör kullandığından
+// sonuç, sıralı toplamdan son basamaklarda farklı olabilir.
+
+static double sumKernel(const double* data, size_t size) {
+    size_t i = 0;
+    double total = 0;
+
+    #if BUILTINS_SSE2
+        __m128d first = _mm_setzero_pd();
+        __m128d second = _mm_setzero_pd();
+
+        for(; i + 4 <= size; i += 4) {
+            first = _mm_add_pd(first, _mm_loadu_pd(data + i));
+            second = _mm_add_pd(second, _mm_loadu_pd(data + i + 2));
+        }
+
+        double lanes[2];
+        _mm_storeu_pd(lanes, _mm_add_pd(first, second));
+        total = lanes[0] + lanes[1];
+    #endif
+
+    for(; i < size; i++)
+        total += data[i];
+
+    return total;
+}
+
+static double dotKernel(const double* a, const double* b, size_t size) {
+    size_t i = 0;
+    double total = 0;
+
+    #if BUILTINS_SSE2
+        __m128d first = _mm_setzero_pd();
+        __m128d second = _mm_setzero_pd();
+
+        for(; i + 4 <= size; i += 4) {
+            first = _mm_add_pd(first, _mm_mul_pd(_mm_loadu_pd(a + i), _mm_loadu_pd(b + i)));
+            second = _mm_add_pd(second, _mm_mul_pd(_mm_loadu_pd(a + i + 2), _mm_loadu_pd(b + i + 2)));
+        }
+
+        double lanes[2];
+        _mm_storeu_pd(lanes, _mm_add_pd(first, second));
+        total = lanes[0] + lanes[1];
+    #endif
+
+    for(; i < size; i++)
+        total += a[i] * b[i];
+
+    return total;
+}
+
+// Boş olmayan dizide en küçük (isMax false) veya en büyük eleman
+static double extremeKernel(const double* data, size_t size, bool isMax) {
+    size_t i = 0;
+    double result = data[0];
+
+    #if BUILTINS_SSE2
+        if(size >= 2) {
+            __m128d best = _mm_loadu_pd(data);
+
+            for(i = 2; i + 2 <= size; i += 2) {
+                __m128d chunk = _mm_loadu_pd(data + i);
+                best = isMax ? _mm_max_pd(best, chunk) : _mm_min_pd(best, chunk);
+            }
+
+            double lanes[2];
+            _mm_storeu_pd(lanes, best);
+            result = isMax ? (lanes[0] > lanes[1] ? lanes[0] : lanes[1])
+                           : (lanes[0] < lanes[1] ? lanes[0] : lanes[1]);
+        }
+    #endif
+
+    for(; i < size; i++) {
+        if(isMax ? data[i] > result : data[i] < result)
+            result = data[i];
+    }
+
+    return result;
+}
+
+static void scaleKernel(const double* data, double factor, double* out, size_t size) {
+    size_t i = 0;
+
+    #if BUILTINS_SSE2
+        __m128d scale = _mm_set1_pd(factor);
+
+        for(; i + 2 <= size; i += 2)
+            _mm_storeu_pd(out + i, _mm_mul_pd(_mm_loadu_pd(data + i), scale));
+    #endif
+
+    for(; i < size; i++)
+        out[i] = data[i] * factor;
+}
+
+static void addKernel(const double* a, const double* b, double* out, size_t size) {
+    size_t i = 0;
+
+    #if BUILTINS_SSE2
+        for(; i + 2 <= size; i += 2)
+            _mm_storeu_pd(out + i, _mm_add_pd(_mm_loadu_pd(a + i), _mm_loadu_pd(b + i)));
+    #endif
+
+    for(; i < size; i++)
+        out[i] = a[i] + b[i];
+}
+
+// Yoğun sayı dizisinin elemanları; boş genel dizi boş sayı dizisi sayılır
+static const std::vector<double>& numbers(const Value& value, const char* function) {
+    static const std::vector<double> empty;
+
+    if(value.isNumberArray())
+        return value.asNumberArray();
+
+    if(value.isArray() && value.arraySize() == 0)
+        return empty;
+
+    throw std::runtime_error(std::string(function) + ": sayı dizisi bekleniyor.");
+}
+
+static void checkSameSize(const std::vector<double>& a, const std::vector<double>& b, const char* function) {
+    if(a.size() != b.size())
+        throw std::runtime_error(std::string(function) + ": dizi boyutları uyuşmuyor.");
+}
+
+static Value sum(const Value* arguments) {
+    const std::vector<double>& data = numbers(arguments[0], "toplam");
+    return Value(sumKernel(data.data(), data.size()));
+}
+
+static Value extreme(const Value& argument, bool isMax, const char* function) {
+    const std::vector<double>& data = numbers(argument, function);
+
+    if(data.empty())
+        throw std::runtime_error(std::string(function) + ": dizi boş.");
+
+    return Value(extremeKernel(data.data(), data.size(), isMax));
+}
+
+static Value min(const Value* arguments) {
+    return extreme(arguments[0], false, "enKüçük");
+}
+
+static Value max(const Value* arguments) {
+    return extreme(arguments[0], true, "enBüyük");
+}
+
+static Value scale(const Value* arguments) {
+    const std::vector<double>& data = numbers(arguments[0], "ölçekle");
+
+    if(!arguments[1].isNumber())
+        throw std::runtime_error("ölçekle: çarpan sayı olmalıdır.");
+
+    std::vector<double> out(data.size());
+    scaleKernel(data.data(), arguments[1].asNumber(), out.data(), data.size());
+    return Value(std::move(out));
+}
+
+static Value add(const Value* arguments) {
+    const std::vector<double>& a = numbers(arguments[0], "diziTopla");
+    const std::vector<double>& b = numbers(arguments[1], "diziTopla");
+    checkSameSize(a, b, "diziTopla");
+
+    std::vector<double> out(a.size());
+    addKernel(a.data(), b.data(), out.data(), a.size());
+    return Value(std::move(out));
+}
+
+static Value dot(const Value* arguments) {
+    const std::vector<double>& a = numbers(arguments[0], "içÇarpım");
+    const std::vector<double>& b = numbers(arguments[1], "içÇarpım");
+    checkSameSize(a, b, "içÇarpım");
+
+    return Value(dotKernel(a.data(), b.data(), a.size()));
+}
+
+static const Builtin BUILTINS[] = {
+    {"toplam", 1, sum},
+    {"enKüçük", 1, min},
+    {"enBüyük", 1, max},
+    {"ölçekle", 2, scale},
+    {"diziTopla", 2, add},
+    {"içÇarpım", 2, dot},
+};
+
+const Builtin* findBuiltin(std::string_view name) {
+    for(const Builtin& builtin : BUILTINS) {
+        if(name == builtin.name)
+            return &builtin;
+    }
+
+    return nullptr;
+}
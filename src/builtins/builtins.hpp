@@ -0,0 +1,27 @@
+#ifndef BUILTINS_HPP
+#define BUILTINS_HPP
+
+#include <cstdint>
+#include <string_view>
+#include "../interpreter/value.hpp"
+
+// Sayı dizileri üzerinde toplu işlem yapan yerleşik fonksiyonlar.
+// Aynı isimde global bir kullanıcı fonksiyonu tanımlıysa o çağrılır,
+// yerleşik fonksiyon yalnızca isim tanımsızken devreye girer.
+//
+//   toplam(d)          elemanların toplamı
+//   enKüçük(d)         en küçük eleman
+//   enBüyük(d)         en büyük eleman
+//   ölçekle(d, k)      her elemanı k ile çarpılmış yeni dizi
+//   diziTopla(a, b)    eleman eleman toplanmış yeni dizi
+//   içÇarpım(a, b)     iki dizinin iç çarpımı
+struct Builtin {
+    const char* name;
+    uint16_t arity;
+    Value (*function)(const Value* arguments);
+};
+
+// İsimle eşleşen yerleşik fonksiyon, yoksa nullptr
+const Builtin* findBuiltin(std::string_view name);
+
+#endif // BUILTINS_HPP
@@ -2,114 +2,158 @@
 
 #include <cmath>
 #include <iostream>
+#include "../builtins/builtins.hpp"
+#include "../output/outputBuffer.hpp"
 
-void Interpreter::Environment::define(const std::string& name, const Value& value, bool isConst) {
-    if(this->variables.find(name) != this->variables.end())
-        throw std::runtime_error("Bu isimde bir değişken zaten tanımlı: " + name);
-
-    this->variables[name] = value;
-    this->constants[name] = isConst;
-}
-
-void Interpreter::Environment::defineFunction(const std::string& name, FunctionDeclStmt* function) {
-    this->functions[name] = function;
+// Slot vektörlerinin kapasitesi korunur, böylece tekrar kullanımda bellek ayrılmaz
+void Interpreter::Environment::reset(Environment* enclosing, size_t slotCount, size_t functionCount) {
+    this->enclosing = enclosing;
+    this->slots.assign(slotCount, Slot());
+    this->functions.assign(functionCount, Function());
 }
 
-Value Interpreter::Environment::get(const std::string& name) {
-    auto it = this->variables.find(name);
-
-    if(it != this->variables.end())
-        return it->second;
-
-    if(this->enclosing != nullptr)
-        return this->enclosing->get(name);
-
-    throw std::runtime_error("Tanımsız değişken: " + name);
-}
-
-FunctionDeclStmt* Interpreter::Environment::getFunction(const std::string& name) {
-    auto it = this->functions.find(name);
-
-    if(it != this->functions.end())
-        return it->second;
-
-    throw std::runtime_error("Tanımsız fonksiyon: " + name);
+Interpreter::Interpreter() {
+    this->globalEnvironment = new Environment(nullptr, 0, 0);
+    this->stats.environmentAllocations++;
+    this->currentEnvironment = this->globalEnvironment;
+    environmentStack.push(currentEnvironment);
 }
 
-void Interpreter::Environment::assign(const std::string& name, const Value& value) {
-    auto it = this->variables.find(name);
-
-    if (it != variables.end()) {
-        auto constIt = this->constants.find(name);
-        if (constIt != this->constants.end() && constIt->second)
-            throw std::runtime_error("Sabit bir değişkene değer atanamaz: " + name);
-
-        // Tip kontrolü
-        Value currentValue = it->second;
-        if (currentValue.isNumber() && !value.isNumber())
-            throw std::runtime_error("Sayı tipindeki değişkene sayı olmayan bir değer atanamaz: " + name);
-        if (currentValue.isString() && !value.isString())
-            throw std::runtime_error("Metin tipindeki değişkene metin olmayan bir değer atanamaz: " + name);
-        if (currentValue.isBool() && !value.isBool())
-            throw std::runtime_error("Boolean tipindeki değişkene boolean olmayan bir değer atanamaz: " + name);
-        if (currentValue.isArray() && !value.isArray())
-            throw std::runtime_error("Dizi tipindeki değişkene dizi olmayan bir değer atanamaz: " + name);
-
-        this->variables[name] = value;
-        return;
+Interpreter::~Interpreter() {
+    while (!this->environmentStack.empty()) {
+        delete this->environmentStack.top();
+        this->environmentStack.pop();
     }
 
-    if (enclosing != nullptr) {
-        enclosing->assign(name, value);
-        return;
-    }
-
-    throw std::runtime_error("Tanımsız değişken: " + name);
+    for (Environment* env : this->environmentPool)
+        delete env;
 }
 
-Interpreter::Interpreter() {
-    this->currentEnvironment = new Environment();
-    environmentStack.push(currentEnvironment);
+const Interpreter::Statistics& Interpreter::statistics() const {
+    return this->stats;
 }
 
 void Interpreter::interpret(AstNode* node) {
     try {
         node->accept(*this);
     } catch (const std::exception& e) {
+        OutputBuffer::instance().flush();
         std::cerr << "[HATA] " << e.what() << std::endl;
     }
 }
 
-void Interpreter::pushEnvironment() {
-    this->currentEnvironment = new Environment(currentEnvironment);
-    this->environmentStack.push(this->currentEnvironment);
+// Havuzdan bir çevre alır, yığına eklemek pushEnvironment ile ayrıca yapılır
+Interpreter::Environment* Interpreter::acquireEnvironment(Environment* enclosing, size_t slotCount, size_t functionCount) {
+    if (this->environmentPool.empty()) {
+        this->stats.environmentAllocations++;
+        return new Environment(enclosing, slotCount, functionCount);
+    }
+
+    Environment* env = this->environmentPool.back();
+    this->environmentPool.pop_back();
+    env->reset(enclosing, slotCount, functionCount);
+    this->stats.environmentReuses++;
+    return env;
 }
 
+void Interpreter::pushEnvironment(Environment* env) {
+    this->currentEnvironment = env;
+    this->environmentStack.push(env);
+}
 
 void Interpreter::popEnvironment() {
     Environment* old = this->environmentStack.top();
     this->environmentStack.pop();
     this->currentEnvironment = this->environmentStack.top();
-    delete old;
+    this->environmentPool.push_back(old);
 }
 
-void Interpreter::enterBlock() {
-    this->pushEnvironment();
+void Interpreter::enterBlock(size_t slotCount, size_t functionCount) {
+    this->pushEnvironment(this->acquireEnvironment(this->currentEnvironment, slotCount, functionCount));
 }
 
 void Interpreter::exitBlock() {
     this->popEnvironment();
 }
 
+Interpreter::Slot& Interpreter::lookup(int depth, unsigned int slot) {
+    if(depth < 0)
+        return this->globals[slot];
+
+    Environment* env = this->currentEnvironment;
+    while(depth-- > 0)
+        env = env->enclosing;
+
+    return env->slots[slot];
+}
+
+Interpreter::Function& Interpreter::lookupFunction(int depth, unsigned int slot) {
+    if(depth < 0)
+        return this->globalFunctions[slot];
+
+    Environment* env = this->currentEnvironment;
+    while(depth-- > 0)
+        env = env->enclosing;
+
+    return env->functions[slot];
+}
+
+void Interpreter::define(Slot& slot, const Value& value, bool isConst, const Token& name) {
+    if(slot.isDefined)
+        throw std::runtime_error("Bu isimde bir değişken zaten tanımlı: " + std::string(name.lexeme()));
+
+    slot.value = value;
+    slot.isDefined = true;
+    slot.isConst = isConst;
+}
+
+void Interpreter::checkAssignable(const Value& current, const Value& value, const Token& name) {
+    if (current.isNumber() && !value.isNumber())
+        throw std::runtime_error("Sayı tipindeki değişkene sayı olmayan bir değer atanamaz: " + std::string(name.lexeme()));
+    if (current.isString() && !value.isString())
+        throw std::runtime_error("Metin tipindeki değişkene metin olmayan bir değer atanamaz: " + std::string(name.lexeme()));
+    if (current.isBool() && !value.isBool())
+        throw std::runtime_error("Boolean tipindeki değişkene boolean olmayan bir değer atanamaz: " + std::string(name.lexeme()));
+    if (current.isArray() && !value.isArray())
+        throw std::runtime_error("Dizi tipindeki değişkene dizi olmayan bir değer atanamaz: " + std::string(name.lexeme()));
+}
+
+void Interpreter::assign(Slot& slot, const Value& value, const Token& name) {
+    if (!slot.isDefined)
+        throw std::runtime_error("Tanımsız değişken: " + std::string(name.lexeme()));
+
+    if (slot.isConst)
+        throw std::runtime_error("Sabit bir değişkene değer atanamaz: " + std::string(name.lexeme()));
+
+    this->checkAssignable(slot.value, value, name);
+
+    slot.value = value;
+}
+
+// Sonuç kopyalanmadan taşınır; diziler ve metinler için sayaç trafiği oluşmaz
 Value Interpreter::evaluate(Expression* expr) {
     expr->accept(*this);
-    return result;
+    return std::move(this->result);
 }
 
 void Interpreter::execute(Stmt* stmt) {
     stmt->accept(*this);
 }
 
+// Kendi yapısının dışına taşan dur/devam/dön sinyalleri hatadır
+void Interpreter::checkCompletion() {
+    switch(this->completion) {
+    case Completion::BREAK:
+        throw std::runtime_error("'dur' yalnızca döngü içinde kullanılabilir.");
+    case Completion::CONTINUE:
+        throw std::runtime_error("'devam' yalnızca döngü içinde kullanılabilir.");
+    case Completion::RETURN:
+        throw std::runtime_error("'dön' yalnızca fonksiyon içinde kullanılabilir.");
+    default:
+        break;
+    }
+}
+
 bool Interpreter::isTruthy(const Value& value) {
     if (value.isNil())
         return false;
@@ -153,106 +197,81 @@ void Interpreter::checkNumberOperands(const Token& op, const Value& left, const
     throw std::runtime_error("Operandlar sayı olmalıdır.");
 }
 
-void Interpreter::checkTypeCompatibility(const std::string& type, const Value& value) {
-    if (type == "sayı" && !value.isNumber())
-        throw std::runtime_error("Sayı tipindeki değişkene sayı olmayan bir değer atanamaz.");
-
-    if (type == "metin" && !value.isString())
-        throw std::runtime_error("Metin tipindeki değişkene metin olmayan bir değer atanamaz.");
-
-    if (type == "boolean" && !value.isBool())
-        throw std::runtime_error("Boolean tipindeki değişkene boolean olmayan bir değer atanamaz.");
-
-    if (type == "dizi" && !value.isArray())
-        throw std::runtime_error("Dizi tipindeki değişkene dizi olmayan bir değer atanamaz.");
+void Interpreter::checkTypeCompatibility(ValueType type, const Value& value) {
+    switch (type) {
+    case ValueType::NUMBER:
+        if (!value.isNumber())
+            throw std::runtime_error("Sayı tipindeki değişkene sayı olmayan bir değer atanamaz.");
+        break;
+    case ValueType::STRING:
+        if (!value.isString())
+            throw std::runtime_error("Metin tipindeki değişkene metin olmayan bir değer atanamaz.");
+        break;
+    case ValueType::BOOL:
+        if (!value.isBool())
+            throw std::runtime_error("Boolean tipindeki değişkene boolean olmayan bir değer atanamaz.");
+        break;
+    case ValueType::ARRAY:
+        if (!value.isArray())
+            throw std::runtime_error("Dizi tipindeki değişkene dizi olmayan bir değer atanamaz.");
+        break;
+    }
 }
 
-void Interpreter::visitBinaryExpression(BinaryExpression* expr) {
-    Value left = this->evaluate(expr->left.get());
-    Value right = this->evaluate(expr->right.get());
-
-    std::string op(expr->op.start, expr->op.length);
-
-    if(op == "+") {
-        if (left.isNumber() && right.isNumber()) {
-            this->result = Value(left.asNumber() + right.asNumber());
-        } else if(left.isString() && right.isString()) {
-            this->result = Value(left.asString() + right.asString());
-        } else if(left.isString() && right.isNumber()) {
-            this->result = Value(left.asString() + std::to_string(right.asNumber()));
-        } else if(left.isNumber() && right.isString()) {
-            this->result = Value(std::to_string(left.asNumber()) + right.asString());
-        } else if(left.isString() && right.isBool()) {
-            this->result = Value(left.asString() + (right.asBool() ? "doğru" : "yanlış"));
-        } else if(left.isBool() && right.isString()) {
-            this->result = Value((left.asBool() ? "doğru" : "yanlış") + right.asString());
-        } else {
-            throw std::runtime_error("Operandlar sayı, metin veya doğruluk değeri olmalıdır.");
-        }
-    } else if(op == "-") {
-        this->checkNumberOperands(expr->op, left, right);
-        this->result = Value(left.asNumber() - right.asNumber());
-    } else if(op == "*") {
-        this->checkNumberOperands(expr->op, left, right);
-        this->result = Value(left.asNumber() * right.asNumber());
-    } else if(op == "/") {
-        this->checkNumberOperands(expr->op, left, right);
+// Bileşik atamalar (+= vb.) ayrıştırıcıda temel işleme çevrilir
+Value Interpreter::binary(Operator operation, const Token& op, const Value& left, const Value& right) {
+    switch(operation) {
+    case Operator::ADD:
+        if (left.isNumber() && right.isNumber())
+            return Value(left.asNumber() + right.asNumber());
+        if (Value::canConcat(left, right))
+            return Value::concat(left, right);
+
+        throw std::runtime_error("Operandlar sayı, metin veya doğruluk değeri olmalıdır.");
+    case Operator::SUBTRACT:
+        this->checkNumberOperands(op, left, right);
+        return Value(left.asNumber() - right.asNumber());
+    case Operator::MULTIPLY:
+        this->checkNumberOperands(op, left, right);
+        return Value(left.asNumber() * right.asNumber());
+    case Operator::DIVIDE:
+        this->checkNumberOperands(op, left, right);
         if (right.asNumber() == 0)
             throw std::runtime_error("Sıfıra bölme hatası.");
 
-        this->result = Value(left.asNumber() / right.asNumber());
-    } else if(op == "%") {
-        this->checkNumberOperands(expr->op, left, right);
+        return Value(left.asNumber() / right.asNumber());
+    case Operator::MODULUS:
+        this->checkNumberOperands(op, left, right);
         if (right.asNumber() == 0)
             throw std::runtime_error("Sıfıra bölme hatası.");
 
-        this->result = Value(fmod(left.asNumber(), right.asNumber()));
-    } else if(op == "**") {
-        this->checkNumberOperands(expr->op, left, right);
-        this->result = Value(pow(left.asNumber(), right.asNumber()));
-    } else if (op == "+=") {
-        if (left.isNumber() && right.isNumber()) {
-            this->result = Value(left.asNumber() + right.asNumber());
-        } else if (left.isString() && right.isString()) {
-            this->result = Value(left.asString() + right.asString());
-        } else if (left.isString() && right.isNumber()) {
-            this->result = Value(left.asString() + std::to_string(right.asNumber()));
-        } else if (left.isNumber() && right.isString()) {
-            this->result = Value(std::to_string(left.asNumber()) + right.asString());
-        } else if (left.isString() && right.isBool()) {
-            this->result = Value(left.asString() + (right.asBool() ? "doğru" : "yanlış"));
-        } else if (left.isBool() && right.isString()) {
-            this->result = Value((left.asBool() ? "doğru" : "yanlış") + right.asString());
-        } else {
-            throw std::runtime_error("Operandlar sayı, metin veya doğruluk değeri olmalıdır.");
-        }
-    } else if (op == "-=") {
-        this->checkNumberOperands(expr->op, left, right);
-        this->result = Value(left.asNumber() - right.asNumber());
-    } else if (op == "*=") {
-        this->checkNumberOperands(expr->op, left, right);
-        this->result = Value(left.asNumber() * right.asNumber());
-    } else if (op == "/=") {
-        this->checkNumberOperands(expr->op, left, right);
-        if (right.asNumber() == 0)
-            throw std::runtime_error("Sıfıra bölme hatası.");
-        this->result = Value(left.asNumber() / right.asNumber());
+        return Value(fmod(left.asNumber(), right.asNumber()));
+    case Operator::POWER:
+        this->checkNumberOperands(op, left, right);
+        return Value(pow(left.asNumber(), right.asNumber()));
+    default:
+        throw std::runtime_error("Geçersiz ikili işlem.");
     }
 }
 
+void Interpreter::visitBinaryExpression(BinaryExpression* expr) {
+    Value left = this->evaluate(expr->left.get());
+    Value right = this->evaluate(expr->right.get());
+
+    this->result = this->binary(expr->operation, expr->op, left, right);
+}
+
 void Interpreter::visitLogicalExpression(LogicalExpression* expr) {
     Value left = evaluate(expr->left.get());
 
-    std::string op(expr->op.start, expr->op.length);
-
-    if(op == "&&") {
+    if(expr->operation == Operator::AND) {
         if (!this->isTruthy(left)) {
             result = left;
             return;
         }
 
         this->result = this->evaluate(expr->right.get());
-    } else if(op == "||") {
+    } else {
         if (this->isTruthy(left)) {
             this->result = left;
             return;
@@ -265,12 +284,10 @@ void Interpreter::visitLogicalExpression(LogicalExpression* expr) {
 void Interpreter::visitUnaryExpression(UnaryExpression* expr) {
     Value right = this->evaluate(expr->operand.get());
 
-    std::string op(expr->op.start, expr->op.length);
-
-    if(op == "-") {
+    if(expr->operation == Operator::NEGATE) {
         this->checkNumberOperand(expr->op, right);
         this->result = Value(-right.asNumber());
-    } else if(op == "!") {
+    } else {
         this->result = Value(!isTruthy(right));
     }
 }
@@ -279,130 +296,141 @@ void Interpreter::visitComparisonExpression(ComparisonExpression* expr) {
     Value left = this->evaluate(expr->left.get());
     Value right = this->evaluate(expr->right.get());
 
-    std::string op(expr->op.start, expr->op.length);
-
-    if (op == ">") {
+    switch(expr->operation) {
+    case Operator::GREAT:
         this->checkNumberOperands(expr->op, left, right);
         this->result = Value(left.asNumber() > right.asNumber());
-    } else if(op == ">=") {
+        break;
+    case Operator::GREAT_EQUAL:
         this->checkNumberOperands(expr->op, left, right);
         this->result = Value(left.asNumber() >= right.asNumber());
-    } else if(op == "<") {
+        break;
+    case Operator::LESS:
         this->checkNumberOperands(expr->op, left, right);
         this->result = Value(left.asNumber() < right.asNumber());
-    } else if(op == "<=") {
+        break;
+    case Operator::LESS_EQUAL:
         this->checkNumberOperands(expr->op, left, right);
         this->result = Value(left.asNumber() <= right.asNumber());
-    } else if(op == "==")
-        this->result = Value(isEqual(left, right));
-    else if(op == "!=")
-        this->result = Value(!isEqual(left, right));
-}
-
-void Interpreter::visitLiteralExpression(LiteralExpression* expr) {
-    switch(expr->token.type) {
-    case TokenType::NUMBER_LITERAL:
-        this->result = Value(std::stod(expr->value));
         break;
-    case TokenType::STRING_LITERAL:
-        this->result = Value(expr->value);
-        break;
-    case TokenType::TRUE:
-        this->result = Value(true);
+    case Operator::EQUAL:
+        this->result = Value(isEqual(left, right));
         break;
-    case TokenType::FALSE:
-        this->result = Value(false);
+    case Operator::NOT_EQUAL:
+        this->result = Value(!isEqual(left, right));
         break;
     default:
-        this->result = Value();
+        throw std::runtime_error("Geçersiz karşılaştırma işlemi.");
     }
 }
 
+void Interpreter::visitLiteralExpression(LiteralExpression* expr) {
+    this->result = expr->value;
+}
+
 void Interpreter::visitVariableExpression(VariableExpression* expr) {
-    std::string name(expr->name.start, expr->name.length);
-    this->result = this->currentEnvironment->get(name);
+    Slot& slot = this->lookup(expr->depth, expr->slot);
+
+    if(!slot.isDefined)
+        throw std::runtime_error("Tanımsız değişken: " + std::string(expr->name.lexeme()));
+
+    this->result = slot.value;
 }
 
 void Interpreter::visitAssignExpression(AssignExpression* expr) {
     Value value = this->evaluate(expr->value.get());
-    std::string name(expr->name.start, expr->name.length);
-    this->currentEnvironment->assign(name, value);
+    this->assign(this->lookup(expr->depth, expr->slot), value, expr->name);
     this->result = value;
 }
 
 void Interpreter::visitCallExpression(CallExpression* expr) {
-    // Fonksiyon adını al
-    VariableExpression* varExpr = dynamic_cast<VariableExpression*>(expr->callee.get());
-    if (!varExpr) {
+    if (!expr->isBound) {
         throw std::runtime_error("Fonksiyon çağrısı geçersiz.");
     }
-    std::string calleeName(varExpr->name.start, varExpr->name.length);
 
-    // Fonksiyonu bul
-    FunctionDeclStmt* function = nullptr;
-    Environment* env = this->currentEnvironment;
-    while (env != nullptr) {
-        try {
-            function = env->getFunction(calleeName);
-            break;
-        } catch (const std::runtime_error&) {
-            env = env->enclosing;
-        }
+    // Resolver'ın bağladığı slottan fonksiyonu al
+    const Function& found = this->lookupFunction(expr->depth, expr->slot);
+    FunctionDeclStmt* function = found.declaration;
+    Environment* closure = found.closure;
+
+    if (!function && expr->builtin != nullptr) {
+        this->callBuiltin(expr);
+        return;
     }
 
     if (!function) {
-        throw std::runtime_error("Tanımsız fonksiyon: " + calleeName);
+        const Token& name = static_cast<VariableExpression*>(expr->callee.get())->name;
+        throw std::runtime_error("Tanımsız fonksiyon: " + std::string(name.lexeme()));
     }
 
-    // Argümanları değerlendir
-    std::vector<Value> arguments;
-    for (auto& arg : expr->arguments) {
-        arguments.push_back(evaluate(arg.get()));
-    }
+    size_t paramCount = function->paramNames.size();
+
+    if (expr->arguments.size() != paramCount) {
+        // Hata, argümanların yan etkilerinden sonra verilir
+        for (auto& arg : expr->arguments)
+            this->evaluate(arg.get());
 
-    // Argüman sayısı kontrolü
-    if (arguments.size() != function->paramNames.size()) {
         throw std::runtime_error("Fonksiyon çağrısında argüman sayısı uyuşmuyor. Beklenen: " +
-            std::to_string(function->paramNames.size()) + ", Verilen: " +
-            std::to_string(arguments.size()));
+            std::to_string(paramCount) + ", Verilen: " +
+            std::to_string(expr->arguments.size()));
     }
 
-    // Yeni bir çevre oluştur
-    this->pushEnvironment();
-
-    // Parametreleri yeni çevreye ekle
-    for (size_t i = 0; i < function->paramNames.size(); i++) {
-        std::string paramName(function->paramNames[i].start, function->paramNames[i].length);
-        std::string paramType(function->paramTypes[i].start, function->paramTypes[i].length);
+    // Argümanlar çağıranın çevresinde değerlendirilip doğrudan fonksiyonun
+    // tanımlandığı çevreyi kapsayan yeni çevrenin slotlarına taşınır
+    Environment* frame = this->acquireEnvironment(closure, paramCount, 0);
 
-        // Tip kontrolü
-        this->checkTypeCompatibility(paramType, arguments[i]);
+    try {
+        for (size_t i = 0; i < paramCount; i++) {
+            expr->arguments[i]->accept(*this);
+            frame->slots[i].value = std::move(this->result);
+        }
 
-        this->currentEnvironment->define(paramName, arguments[i]);
+        for (size_t i = 0; i < paramCount; i++) {
+            this->checkTypeCompatibility(function->paramValueTypes[i], frame->slots[i].value);
+            frame->slots[i].isDefined = true;
+        }
+    } catch (...) {
+        this->environmentPool.push_back(frame);
+        throw;
     }
 
+    this->pushEnvironment(frame);
+
     // Fonksiyon gövdesini çalıştır
-    try {
-        this->execute(function->body.get());
-    } catch (const std::runtime_error& e) {
-        if (std::string(e.what()) == "RETURN") {
-            // Return değeri zaten result'ta, bir şey yapmaya gerek yok
-        } else {
-            this->popEnvironment();
-            throw e;
-        }
+    this->execute(function->body.get());
+
+    if (this->completion == Completion::RETURN) {
+        // Dönüş değeri zaten result'ta
+        this->completion = Completion::NORMAL;
+    } else {
+        this->checkCompletion();
+        this->result = Value();
     }
 
     // Çevreyi temizle
     this->popEnvironment();
 }
 
+void Interpreter::callBuiltin(CallExpression* expr) {
+    std::vector<Value> arguments;
+    for (auto& arg : expr->arguments)
+        arguments.push_back(this->evaluate(arg.get()));
+
+    if (arguments.size() != expr->builtin->arity) {
+        throw std::runtime_error("Fonksiyon çağrısında argüman sayısı uyuşmuyor. Beklenen: " +
+            std::to_string(expr->builtin->arity) + ", Verilen: " +
+            std::to_string(arguments.size()));
+    }
+
+    this->result = expr->builtin->function(arguments.data());
+}
+
 void Interpreter::visitArrayExpression(ArrayExpression* expr) {
     std::vector<Value> elements;
     for (auto& element : expr->elements) {
         elements.push_back(evaluate(element.get()));
     }
-    this->result = Value(elements);
+    this->result = Value::array(std::move(elements));
 }
 
 void Interpreter::visitArrayAccessExpression(ArrayAccessExpression* expr) {
@@ -416,28 +444,67 @@ void Interpreter::visitArrayAccessExpression(ArrayAccessExpression* expr) {
         throw std::runtime_error("Dizi indeksi sayı olmalıdır.");
 
     int idx = static_cast<int>(index.asNumber());
-    const std::vector<Value>& elements = array.asArray();
 
-    if (idx < 0 || idx >= elements.size())
+    if (idx < 0 || idx >= static_cast<int>(array.arraySize()))
         throw std::runtime_error("Dizi indeksi sınırlar dışında.");
 
-    this->result = elements[idx];
+    this->result = array.arrayAt(idx);
 }
 
-/*void Interpreter::visitArrayAssignExpression(ArrayAssignExpression* expr) {
-    Value array = this->evaluate(expr->array.get());
-    Value index = this->evaluate(expr->index.get());
+// İndeksler ve değer önce değerlendirilir, eleman ancak sonra kök slottan
+// başlanarak referansla bulunur; böylece değer ifadesi diziyi değiştirse de
+// geçersiz bir referans kullanılmaz. Paylaşılmayan dizi yerinde değişir.
+void Interpreter::visitArrayAssignExpression(ArrayAssignExpression* expr) {
+    size_t base = this->indexStack.size();
+    for (auto& index : expr->indices)
+        this->indexStack.push_back(this->evaluate(index.get()));
+
     Value value = this->evaluate(expr->value.get());
 
-    if (!array.isArray())
-        throw std::runtime_error("Dizi olmayan bir değere atama yapılamaz.");
+    Slot& slot = this->lookup(expr->depth, expr->slot);
+    if (!slot.isDefined)
+        throw std::runtime_error("Tanımsız değişken: " + std::string(expr->name.lexeme()));
 
-    if (!index.isNumber())
-        throw std::runtime_error("Dizi indeksi sayı olmalıdır.");
+    if (slot.isConst)
+        throw std::runtime_error("Sabit bir değişkene değer atanamaz: " + std::string(expr->name.lexeme()));
 
-    // TODO: Dizi atama implementasyonu
-    this->result = value;
-}*/
+    // Son indekse kadar iç diziler referansla izlenir, son eleman kapsayan diziye yazılır
+    Value* container = &slot.value;
+    size_t idx = 0;
+    for (size_t i = base; i < this->indexStack.size(); i++) {
+        const Value& index = this->indexStack[i];
+
+        if (!container->isArray())
+            throw std::runtime_error("Dizi olmayan bir değere atama yapılamaz.");
+
+        if (!index.isNumber())
+            throw std::runtime_error("Dizi indeksi sayı olmalıdır.");
+
+        int position = static_cast<int>(index.asNumber());
+        if (position < 0 || position >= static_cast<int>(container->arraySize()))
+            throw std::runtime_error("Dizi indeksi sınırlar dışında.");
+
+        idx = static_cast<size_t>(position);
+        if (i + 1 == this->indexStack.size())
+            break;
+
+        // Yoğun sayı dizisinin elemanları dizi olamaz
+        if (container->isNumberArray())
+            throw std::runtime_error("Dizi olmayan bir değere atama yapılamaz.");
+
+        container = &container->asMutableArray()[idx];
+    }
+
+    this->indexStack.resize(base);
+
+    Value current = container->arrayAt(idx);
+    if (expr->isCompound)
+        value = this->binary(expr->operation, expr->op, current, value);
+
+    this->checkAssignable(current, value, expr->name);
+    container->setArrayAt(idx, value);
+    this->result = std::move(value);
+}
 
 void Interpreter::visitExpressionStmt(ExpressionStmt* stmt) {
     this->evaluate(stmt->expression.get());
@@ -445,7 +512,7 @@ void Interpreter::visitExpressionStmt(ExpressionStmt* stmt) {
 
 void Interpreter::visitPrintStmt(PrintStmt* stmt) {
     Value value = this->evaluate(stmt->expression.get());
-    std::cout << value.toString() << std::endl;
+    OutputBuffer::instance().printLine(value);
 }
 
 void Interpreter::visitVarDeclStmt(VarDeclStmt* stmt) {
@@ -453,20 +520,26 @@ void Interpreter::visitVarDeclStmt(VarDeclStmt* stmt) {
 
     if(stmt->initializer != nullptr) {
         value = this->evaluate(stmt->initializer.get());
-        std::string type(stmt->type.start, stmt->type.length);
-        this->checkTypeCompatibility(type, value);
+        this->checkTypeCompatibility(stmt->valueType, value);
     }
 
-    std::string name(stmt->name.start, stmt->name.length);
-    this->currentEnvironment->define(name, value, stmt->isConst);
+    this->define(this->lookup(stmt->depth, stmt->slot), value, stmt->isConst, stmt->name);
 }
 
 void Interpreter::visitBlockStmt(BlockStmt* stmt) {
-    this->enterBlock();
+    this->enterBlock(stmt->slotCount, stmt->functionCount);
 
-    for(auto& stmt : stmt->statements)
+    for(FunctionDeclStmt* function : stmt->functions)
+        this->lookupFunction(function->depth, function->slot) = Function{function, this->currentEnvironment};
+
+    for(auto& stmt : stmt->statements) {
         this->execute(stmt.get());
 
+        // dur/devam/dön bloğun kalanını atlar
+        if(this->completion != Completion::NORMAL)
+            break;
+    }
+
     this->exitBlock();
 }
 
@@ -479,67 +552,57 @@ void Interpreter::visitIfStmt(IfStmt* stmt) {
 
 void Interpreter::visitLoopStmt(LoopStmt* stmt) {
     while(this->isTruthy(this->evaluate(stmt->condition.get()))) {
-        try {
-            this->execute(stmt->body.get());
-        } catch (const std::runtime_error& e) {
-            std::string error = e.what();
-            if (error == "BREAK") {
-                break;
-            } else if (error == "CONTINUE") {
-                continue;
-            } else {
-                throw e;
-            }
+        this->execute(stmt->body.get());
+
+        if(this->completion == Completion::BREAK) {
+            this->completion = Completion::NORMAL;
+            break;
         }
+
+        if(this->completion == Completion::CONTINUE)
+            this->completion = Completion::NORMAL;
+        else if(this->completion == Completion::RETURN)
+            return;
     }
 }
 
 void Interpreter::visitBreakStmt(BreakStmt* stmt) {
-    throw std::runtime_error("BREAK");
+    this->completion = Completion::BREAK;
 }
 
 void Interpreter::visitContinueStmt(ContinueStmt* stmt) {
-    throw std::runtime_error("CONTINUE");
+    this->completion = Completion::CONTINUE;
 }
 
 void Interpreter::visitFunctionDeclStmt(FunctionDeclStmt* stmt) {
-    std::string name(stmt->name.start, stmt->name.length);
-    // Fonksiyonu global scope'ta tanımla
-    this->environmentStack.top()->defineFunction(name, stmt);
+    // Bloğun başında tanımlanan fonksiyonlar yeniden tanımlanmaz
+    if (stmt->isHoisted)
+        return;
+
+    // Fonksiyonu Resolver'ın atadığı slotta, içinde bulunulan çevreyle tanımla
+    this->lookupFunction(stmt->depth, stmt->slot) = Function{stmt, this->currentEnvironment};
 }
 
 void Interpreter::visitReturnStmt(ReturnStmt* stmt) {
-    // Fonksiyonun dönüş tipini bul
-    std::string returnType;
-    Environment* env = this->currentEnvironment;
-    while (env != nullptr) {
-        for (const auto& [name, func] : env->functions) {
-            // Fonksiyonun gövdesini kontrol et
-            if (func->body.get() && func->body->statements.size() > 0) {
-                // Return ifadesinin bu fonksiyonun gövdesinde olup olmadığını kontrol et
-                for (const auto& bodyStmt : func->body->statements) {
-                    if (bodyStmt.get() == stmt) {
-                        // Eğer returnType token'ı EOF ise, bu fonksiyon değer döndürmüyor demektir
-                        if (func->returnType.type == TokenType::TOKEN_EOF) {
-                            if (stmt->value != nullptr) {
-                                throw std::runtime_error("Bu fonksiyon değer döndürmemeli.");
-                            }
-                            this->result = Value();
-                            throw std::runtime_error("RETURN");
-                        }
-                        returnType = std::string(func->returnType.start, func->returnType.length);
-                        break;
-                    }
-                }
-            }
-            if (!returnType.empty()) break;
-        }
-        if (!returnType.empty()) break;
-        env = env->enclosing;
+    // Resolver dönüşü ait olduğu fonksiyona bağlar
+    FunctionDeclStmt* function = stmt->function;
+
+    if (function == nullptr)
+        throw std::runtime_error("'dön' yalnızca fonksiyon içinde kullanılabilir.");
+
+    // Eğer returnType token'ı EOF ise, bu fonksiyon değer döndürmüyor demektir
+    if (function->returnType.type == TokenType::TOKEN_EOF) {
+        if (stmt->value != nullptr)
+            throw std::runtime_error("Bu fonksiyon değer döndürmemeli.");
+
+        this->result = Value();
+        this->completion = Completion::RETURN;
+        return;
     }
 
     // Dönüş değeri yoksa
     if (stmt->value == nullptr) {
+        std::string returnType(function->returnType.lexeme());
         throw std::runtime_error("Fonksiyon " + returnType + " tipinde değer döndürmeli.");
     }
 
@@ -547,18 +610,33 @@ void Interpreter::visitReturnStmt(ReturnStmt* stmt) {
     Value value = this->evaluate(stmt->value.get());
 
     // Dönüş tipi kontrolü
-    if (returnType == "sayı" && !value.isNumber())
-        throw std::runtime_error("Fonksiyon sayı tipinde değer döndürmeli.");
-    if (returnType == "metin" && !value.isString())
-        throw std::runtime_error("Fonksiyon metin tipinde değer döndürmeli.");
-    if (returnType == "doğruluk" && !value.isBool())
-        throw std::runtime_error("Fonksiyon doğruluk tipinde değer döndürmeli.");
+    switch (function->returnType.type) {
+    case TokenType::TYPE_NUMBER:
+        if (!value.isNumber())
+            throw std::runtime_error("Fonksiyon sayı tipinde değer döndürmeli.");
+        break;
+    case TokenType::TYPE_STRING:
+        if (!value.isString())
+            throw std::runtime_error("Fonksiyon metin tipinde değer döndürmeli.");
+        break;
+    case TokenType::TYPE_BOOL:
+        if (!value.isBool())
+            throw std::runtime_error("Fonksiyon doğruluk tipinde değer döndürmeli.");
+        break;
+    default:
+        break;
+    }
 
     this->result = value;
-    throw std::runtime_error("RETURN");
+    this->completion = Completion::RETURN;
 }
 
 void Interpreter::visitProgram(Program* program) {
-    for(auto& stmt : program->statements)
+    this->globals.assign(program->globalSymbols.size(), Slot());
+    this->globalFunctions.assign(program->globalFunctionSymbols.size(), Function());
+
+    for(auto& stmt : program->statements) {
         this->execute(stmt.get());
+        this->checkCompletion();
+    }
 }
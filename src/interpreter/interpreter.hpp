@@ -10,42 +10,85 @@
 
 class Interpreter : public ASTVisitor {
 public:
+    // Bellek kullanımını ölçmek için sayaçlar
+    struct Statistics {
+        size_t environmentAllocations = 0;
+        size_t environmentReuses = 0;
+    };
+
     Interpreter();
+    ~Interpreter();
     void interpret(AstNode* node);
+    const Statistics& statistics() const;
 
 private:
+    // Resolver'ın atadığı slotlarda tutulan değişken
+    struct Slot {
+        Value value;
+        bool isDefined = false;
+        bool isConst = false;
+    };
+
+    struct Environment;
+
+    // Tanımlandığı çevreyle birlikte saklanan fonksiyon
+    struct Function {
+        FunctionDeclStmt* declaration = nullptr;
+        Environment* closure = nullptr;
+    };
+
     // Çalışma zamanı ortamı
     struct Environment {
-        std::unordered_map<std::string, Value> variables;
-        std::unordered_map<std::string, FunctionDeclStmt*> functions;
-        std::unordered_map<std::string, bool> constants; // sbt/const değişkenler için
+        std::vector<Slot> slots;
+        std::vector<Function> functions; // Resolver'ın atadığı fonksiyon slotları
         Environment* enclosing;
 
-        Environment() : enclosing(nullptr) {}
-        Environment(Environment* enclosing) : enclosing(enclosing) {}
+        Environment(Environment* enclosing, size_t slotCount, size_t functionCount)
+            : slots(slotCount), functions(functionCount), enclosing(enclosing) {}
 
-        void define(const std::string& name, const Value& value, bool isConst = false);
-        void defineFunction(const std::string& name, FunctionDeclStmt* function);
-        Value get(const std::string& name);
-        FunctionDeclStmt* getFunction(const std::string& name);
-        void assign(const std::string& name, const Value& value);
+        void reset(Environment* enclosing, size_t slotCount, size_t functionCount);
     };
 
+    // dur/devam/dön istisna fırlatmak yerine bu durumla yayılır
+    enum class Completion {
+        NORMAL,
+        BREAK,
+        CONTINUE,
+        RETURN
+    };
+
+    Environment* globalEnvironment;
     Environment* currentEnvironment;
     std::stack<Environment*> environmentStack;
+    std::vector<Environment*> environmentPool; // Blok ve çağrılar arasında yeniden kullanılan çevreler
+    Statistics stats;
+    std::vector<Slot> globals;
+    std::vector<Value> indexStack; // Dizi elemanına atamada değerlendirilen indeksler
+    std::vector<Function> globalFunctions;
     Value result;
+    Completion completion = Completion::NORMAL;
+
+    Slot& lookup(int depth, unsigned int slot);
+    Function& lookupFunction(int depth, unsigned int slot);
+    void define(Slot& slot, const Value& value, bool isConst, const Token& name);
+    void assign(Slot& slot, const Value& value, const Token& name);
+    void checkAssignable(const Value& current, const Value& value, const Token& name);
 
-    void pushEnvironment();
+    Environment* acquireEnvironment(Environment* enclosing, size_t slotCount, size_t functionCount);
+    void pushEnvironment(Environment* env);
     void popEnvironment();
-    void enterBlock();
+    void enterBlock(size_t slotCount, size_t functionCount);
     void exitBlock();
     Value evaluate(Expression* expr);
     void execute(Stmt* stmt);
+    void checkCompletion();
     bool isTruthy(const Value& value);
     bool isEqual(const Value& a, const Value& b);
     void checkNumberOperand(const Token& op, const Value& operand);
     void checkNumberOperands(const Token& op, const Value& left, const Value& right);
-    void checkTypeCompatibility(const std::string& type, const Value& value);
+    void callBuiltin(CallExpression* expr);
+    Value binary(Operator operation, const Token& op, const Value& left, const Value& right);
+    void checkTypeCompatibility(ValueType type, const Value& value);
 
 
     // AST Visitor implementasyonları
@@ -59,7 +102,7 @@ private:
     void visitCallExpression(CallExpression* expr) override;
     void visitArrayExpression(ArrayExpression* expr) override;
     void visitArrayAccessExpression(ArrayAccessExpression* expr) override;
-    //void visitArrayAssignExpression(ArrayAssignExpression* expr) override;
+    void visitArrayAssignExpression(ArrayAssignExpression* expr) override;
 
     void visitExpressionStmt(ExpressionStmt* stmt) override;
     void visitPrintStmt(PrintStmt* stmt) override;
@@ -1,92 +1,356 @@
 #include "value.hpp"
-#include <sstream>
+#include <charconv>
+#include <cstdio>
+#include <utility>
+
+// Metin ya düz bir std::string ya da henüz birleştirilmemiş iki parçadır.
+// Parçalar metin, sayı veya doğruluk değeri olabilir; ilk okumada düzleştirilir.
+struct Value::StringObject : Value::Object {
+    std::string value;
+    Value left;
+    Value right;
+
+    explicit StringObject(std::string value) : value(std::move(value)) {}
+    StringObject(const Value& left, const Value& right) : left(left), right(right) {}
+
+    bool isRope() const { return !this->left.isNil(); }
+};
+
+// std::to_string ile aynı biçim, ara metin oluşturmadan hedefin sonuna yazılır
+static void appendNumber(std::string& out, double number) {
+    size_t at = out.size();
+    out.resize(at + 32);
+
+    int length = std::snprintf(&out[at], 33, "%f", number);
+    if(length > 32) {
+        out.resize(at + length);
+        std::snprintf(&out[at], length + 1, "%f", number);
+    }
+
+    out.resize(at + length);
+}
+
+struct Value::ArrayObject : Value::Object {
+    std::vector<Value> values;
+
+    explicit ArrayObject(std::vector<Value> values) : values(std::move(values)) {}
+};
+
+struct Value::NumberArrayObject : Value::Object {
+    std::vector<double> values;
+
+    explicit NumberArrayObject(std::vector<double> values) : values(std::move(values)) {}
+};
+
+static_assert(sizeof(Value) == 16, "Value 16 bayt olmalıdır");
 
 Value::Value()
-    : value(std::monostate{}) {}
+    : type(Type::NIL) {
+    this->as.object = nullptr;
+}
 
 Value::Value(bool value)
-    : value(value) {}
+    : type(Type::BOOL) {
+    this->as.boolean = value;
+}
 
 Value::Value(double value)
-    : value(value) {}
+    : type(Type::NUMBER) {
+    this->as.number = value;
+}
 
 Value::Value(const std::string& value)
-    : value(value) {}
+    : type(Type::STRING) {
+    this->as.object = new StringObject(value);
+}
+
+Value::Value(std::string&& value)
+    : type(Type::STRING) {
+    this->as.object = new StringObject(std::move(value));
+}
 
 Value::Value(const std::vector<Value>& values)
-    : value(values) {}
+    : type(Type::ARRAY) {
+    this->as.object = new ArrayObject(values);
+}
+
+Value::Value(std::vector<Value>&& values)
+    : type(Type::ARRAY) {
+    this->as.object = new ArrayObject(std::move(values));
+}
+
+Value::Value(std::vector<double>&& numbers)
+    : type(Type::NUMBER_ARRAY) {
+    this->as.object = new NumberArrayObject(std::move(numbers));
+}
+
+Value Value::array(std::vector<Value>&& values) {
+    if(values.empty())
+        return Value(std::move(values));
+
+    for(const Value& value : values) {
+        if(!value.isNumber())
+            return Value(std::move(values));
+    }
+
+    std::vector<double> numbers;
+    numbers.reserve(values.size());
+    for(const Value& value : values)
+        numbers.push_back(value.as.number);
+
+    return Value(std::move(numbers));
+}
+
+bool Value::canConcat(const Value& left, const Value& right) {
+    if(!left.isString() && !right.isString())
+        return false;
+
+    return (left.isString() || left.isNumber() || left.isBool()) &&
+           (right.isString() || right.isNumber() || right.isBool());
+}
+
+Value Value::concat(const Value& left, const Value& right) {
+    Value result;
+    result.type = Type::STRING;
+    result.as.object = new StringObject(left, right);
+    return result;
+}
+
+Value::Value(const Value& other)
+    : type(other.type), as(other.as) {
+    this->retain();
+}
+
+Value::Value(Value&& other) noexcept
+    : type(other.type), as(other.as) {
+    other.type = Type::NIL;
+    other.as.object = nullptr;
+}
+
+Value& Value::operator=(const Value& other) {
+    if(this != &other) {
+        other.retain();
+        this->release();
+        this->type = other.type;
+        this->as = other.as;
+    }
+    return *this;
+}
+
+Value& Value::operator=(Value&& other) noexcept {
+    if(this != &other) {
+        this->release();
+        this->type = other.type;
+        this->as = other.as;
+        other.type = Type::NIL;
+        other.as.object = nullptr;
+    }
+    return *this;
+}
+
+Value::~Value() {
+    this->release();
+}
+
+bool Value::isObject() const {
+    return this->type == Type::STRING || this->type == Type::ARRAY || this->type == Type::NUMBER_ARRAY;
+}
+
+void Value::retain() const {
+    if(this->isObject())
+        this->as.object->refCount++;
+}
+
+// Uzun birleştirme zincirleri özyinelemeli yıkılırsa yığın taşar; yalnızca
+// bu metne ait parçalar sahiplenilip bir iş listesi üzerinden silinir
+void Value::destroyString(StringObject* object) {
+    std::vector<StringObject*> pending{object};
+
+    while(!pending.empty()) {
+        StringObject* current = pending.back();
+        pending.pop_back();
+
+        for(Value* part : {&current->left, &current->right}) {
+            if(part->type == Type::STRING && part->as.object->refCount == 1) {
+                pending.push_back(static_cast<StringObject*>(part->as.object));
+                part->type = Type::NIL;
+                part->as.object = nullptr;
+            }
+        }
+
+        delete current;
+    }
+}
+
+void Value::release() {
+    if(!this->isObject() || --this->as.object->refCount > 0)
+        return;
+
+    if(this->type == Type::STRING)
+        destroyString(static_cast<StringObject*>(this->as.object));
+    else if(this->type == Type::ARRAY)
+        delete static_cast<ArrayObject*>(this->as.object);
+    else
+        delete static_cast<NumberArrayObject*>(this->as.object);
+}
 
 bool Value::isNil() const {
-    return std::holds_alternative<std::monostate>(this->value);
+    return this->type == Type::NIL;
 }
 
 bool Value::isBool() const {
-    return std::holds_alternative<bool>(this->value);
+    return this->type == Type::BOOL;
 }
 
 bool Value::isNumber() const {
-    return std::holds_alternative<double>(this->value);
+    return this->type == Type::NUMBER;
 }
 
 bool Value::isString() const {
-    return std::holds_alternative<std::string>(this->value);
+    return this->type == Type::STRING;
 }
 
 bool Value::isArray() const {
-    return std::holds_alternative<std::vector<Value>>(this->value);
+    return this->type == Type::ARRAY || this->type == Type::NUMBER_ARRAY;
+}
+
+bool Value::isNumberArray() const {
+    return this->type == Type::NUMBER_ARRAY;
 }
 
 bool Value::asBool() const {
-    return std::get<bool>(this->value);
+    return this->as.boolean;
 }
 
 double Value::asNumber() const {
-    return std::get<double>(this->value);
+    return this->as.number;
 }
 
 const std::string& Value::asString() const {
-    return std::get<std::string>(this->value);
+    auto* string = static_cast<StringObject*>(this->as.object);
+
+    if(string->isRope())
+        flatten(string);
+
+    return string->value;
 }
 
 const std::vector<Value>& Value::asArray() const {
-    return std::get<std::vector<Value>>(this->value);
+    return static_cast<const ArrayObject*>(this->as.object)->values;
 }
 
-std::string Value::toString() const {
-    if(this->isNil())
-        return "nil";
+// Parçalar soldan sağa açık bir yığınla gezilir, derin zincirlerde özyineleme yapılmaz
+void Value::flatten(StringObject* string) {
+    std::string out;
+    std::vector<const Value*> parts{&string->right, &string->left};
 
-    if(this->isBool())
-        return this->asBool() ? "doğru" : "yanlış";
+    while(!parts.empty()) {
+        const Value* part = parts.back();
+        parts.pop_back();
 
-    if(this->isNumber()) {
-        std::ostringstream oss;
-        oss << this->asNumber();
-        return oss.str();
-    }
+        if(part->isNumber()) {
+            appendNumber(out, part->as.number);
+        } else if(part->isBool()) {
+            out += part->as.boolean ? "doğru" : "yanlış";
+        } else {
+            auto* piece = static_cast<const StringObject*>(part->as.object);
 
-    if(this->isString()) {
-        std::string str = this->asString();
-        if (!str.empty() && str.front() == '"' && str.back() == '"') {
-            return str.substr(1, str.length() - 2);
+            if(piece->isRope()) {
+                parts.push_back(&piece->right);
+                parts.push_back(&piece->left);
+            } else {
+                out += piece->value;
+            }
         }
-        return str;
     }
 
-    if(this->isArray()) {
-        std::string result = "[";
-        const std::vector<Value>& array = this->asArray();
+    string->value = std::move(out);
+    string->left = Value();
+    string->right = Value();
+}
+
+// Başka değerlerle paylaşılan dizi değiştirilmeden önce bu değer için kopyalanır
+std::vector<Value>& Value::asMutableArray() {
+    auto* array = static_cast<ArrayObject*>(this->as.object);
 
-        for (size_t i = 0; i < array.size(); ++i) {
-            if (i > 0) {
-                result += ", ";
-            }
-            result += array[i].toString();
-        }
+    if(array->refCount > 1) {
+        array->refCount--;
+        array = new ArrayObject(array->values);
+        this->as.object = array;
+    }
+
+    return array->values;
+}
+
+const std::vector<double>& Value::asNumberArray() const {
+    return static_cast<const NumberArrayObject*>(this->as.object)->values;
+}
+
+size_t Value::arraySize() const {
+    if(this->type == Type::NUMBER_ARRAY)
+        return this->asNumberArray().size();
+
+    return this->asArray().size();
+}
+
+Value Value::arrayAt(size_t index) const {
+    if(this->type == Type::NUMBER_ARRAY)
+        return Value(this->asNumberArray()[index]);
+
+    return this->asArray()[index];
+}
+
+void Value::setArrayAt(size_t index, const Value& value) {
+    if(this->type == Type::ARRAY) {
+        this->asMutableArray()[index] = value;
+        return;
+    }
+
+    auto* array = static_cast<NumberArrayObject*>(this->as.object);
 
-        result += "]";
-        return result;
+    if(array->refCount > 1) {
+        array->refCount--;
+        array = new NumberArrayObject(array->values);
+        this->as.object = array;
     }
 
-    return "bilinmeyen";
-}
\ No newline at end of file
+    array->values[index] = value.asNumber();
+}
+
+std::string Value::toString() const {
+    std::string out;
+    this->appendTo(out);
+    return out;
+}
+
+// Sayılar std::ostream'in varsayılan biçimiyle (%g, 6 basamak) yazılır
+void Value::appendTo(std::string& out) const {
+    if(this->isNil()) {
+        out += "nil";
+    } else if(this->isBool()) {
+        out += this->asBool() ? "doğru" : "yanlış";
+    } else if(this->isNumber()) {
+        char digits[32];
+        auto result = std::to_chars(digits, digits + sizeof(digits), this->asNumber(), std::chars_format::general, 6);
+        out.append(digits, result.ptr);
+    } else if(this->isString()) {
+        const std::string& str = this->asString();
+        if (!str.empty() && str.front() == '"' && str.back() == '"')
+            out.append(str, 1, str.length() - 2);
+        else
+            out += str;
+    } else if(this->isArray()) {
+        out += '[';
+        size_t size = this->arraySize();
+
+        for (size_t i = 0; i < size; ++i) {
+            if (i > 0)
+                out += ", ";
+            this->arrayAt(i).appendTo(out);
+        }
+
+        out += ']';
+    } else {
+        out += "bilinmeyen";
+    }
+}
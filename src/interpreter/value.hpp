@@ -1,35 +1,94 @@
 #ifndef VALUE_HPP
 #define VALUE_HPP
 
+#include <cstdint>
 #include <string>
 #include <vector>
-#include <variant>
 
+// 16 baytlık etiketli değer. Sayı ve doğruluk değerleri doğrudan tutulur,
+// metin ve diziler referans sayımlı heap nesnelerinde paylaşılır; bu yüzden
+// bir değeri kopyalamak yalnızca sayaç artırmaktır. Diziler yazılırken
+// kopyalanır: paylaşılan bir dizi ancak değiştirilmeden önce ayrılır.
+// Bütün elemanları sayı olan diziler kutulanmamış double'lar halinde
+// yoğun olarak tutulur; dışarıdan ikisi de aynı dizi tipidir.
 class Value {
 public:
-    using ValueType = std::variant<std::monostate, bool, double, std::string, std::vector<Value>>;
-
     Value();
     explicit Value(bool value);
     explicit Value(double value);
     explicit Value(const std::string& value);
+    explicit Value(std::string&& value);
     explicit Value(const std::vector<Value>& values);
+    explicit Value(std::vector<Value>&& values);
+    explicit Value(std::vector<double>&& numbers);
+
+    // Elemanların hepsi sayıysa yoğun sayı dizisi, değilse genel dizi oluşturur
+    static Value array(std::vector<Value>&& values);
+
+    // '+' ile metin birleştirme: en az biri metin, diğeri metin, sayı veya doğruluk.
+    // Sonuç parçaları kopyalamadan tutar ve ilk okunduğunda düzleştirilir.
+    static bool canConcat(const Value& left, const Value& right);
+    static Value concat(const Value& left, const Value& right);
+
+    Value(const Value& other);
+    Value(Value&& other) noexcept;
+    Value& operator=(const Value& other);
+    Value& operator=(Value&& other) noexcept;
+    ~Value();
 
     bool isNil() const;
     bool isBool() const;
     bool isNumber() const;
     bool isString() const;
     bool isArray() const;
+    bool isNumberArray() const;
 
     bool asBool() const;
     double asNumber() const;
     const std::string& asString() const;
     const std::vector<Value>& asArray() const;
+    std::vector<Value>& asMutableArray();
+    const std::vector<double>& asNumberArray() const;
+
+    // Her iki dizi türünde de çalışır; indeks sınırları çağıranca denetlenir
+    size_t arraySize() const;
+    Value arrayAt(size_t index) const;
+    // Yoğun sayı dizisine yalnızca sayı yazılabilir
+    void setArrayAt(size_t index, const Value& value);
 
     std::string toString() const;
+    void appendTo(std::string& out) const;
 
 private:
-    ValueType value;
+    enum class Type : uint8_t {
+        NIL,
+        BOOL,
+        NUMBER,
+        STRING,
+        ARRAY,
+        NUMBER_ARRAY
+    };
+
+    struct Object {
+        uint32_t refCount = 1;
+    };
+
+    struct StringObject;
+    struct ArrayObject;
+    struct NumberArrayObject;
+
+    Type type;
+    union {
+        bool boolean;
+        double number;
+        Object* object;
+    } as;
+
+    bool isObject() const;
+    void retain() const;
+    void release();
+    static void destroyString(StringObject* object);
+    static void flatten(StringObject* string);
 };
 
 #endif //VALUE_HPP
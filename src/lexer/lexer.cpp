@@ -1,21 +1,63 @@
 #include "lexer.hpp"
+#include "scan.hpp"
 #include <cstring>
-#include <sstream>
+#include <vector>
+
+namespace {
+
+struct Keyword {
+    std::string_view text;
+    TokenType type = TokenType::IDENTIFIER;
+};
+
+constexpr Keyword KEYWORDS[] = {
+    {"metin", TokenType::TYPE_STRING},
+    {"sayı", TokenType::TYPE_NUMBER},
+    {"doğruluk", TokenType::TYPE_BOOL},
+    {"doğru", TokenType::TRUE},
+    {"yanlış", TokenType::FALSE},
+    {"eğer", TokenType::IF},
+    {"yoksa", TokenType::ELSE},
+    {"döngü", TokenType::LOOP},
+    {"deg", TokenType::VAR},
+    {"sbt", TokenType::CONST},
+    {"fonk", TokenType::FUNCTION},
+    {"dön", TokenType::RETURN},
+    {"eşle", TokenType::SWITCH},
+    {"dur", TokenType::BREAK},
+    {"devam", TokenType::CONTINUE},
+    {"yaz", TokenType::PRINT},
+};
+
+// Anahtar kelimeler de sembol tablosuna eklenir, böylece bir tanımlayıcı tek
+// bir tablo aramasıyla hem sembolünü hem de anahtar kelime olup olmadığını
+// öğrenir. Tablo sembol numarasıyla indekslenir ve bir kez oluşturulur.
+const std::vector<TokenType>& keywordsBySymbol() {
+    static const std::vector<TokenType> table = [] {
+        std::vector<TokenType> table;
+
+        for(const Keyword& keyword : KEYWORDS) {
+            Symbol symbol = SymbolTable::instance().intern(keyword.text.data(), keyword.text.size());
+
+            if(symbol >= table.size())
+                table.resize(symbol + 1, TokenType::IDENTIFIER);
+            table[symbol] = keyword.type;
+        }
 
-Lexer::Lexer(const std::string& source, const std::string& fileName)
-    :source(source), fileName(fileName), startPosition(0), currentPosition(0), currentLine(1), currentColumn(0) {}
+        return table;
+    }();
 
-std::vector<Token> Lexer::scanner() {
-    std::vector<Token> tokens;
+    return table;
+}
 
-    do
-        tokens.push_back(this->scanToken());
-    while(tokens.back().type != TokenType::TOKEN_EOF);
+} // namespace
 
-    return tokens;
-}
+// Satır ve sütun tutulmaz, gerektiğinde SourceManager ofsetten hesaplar
+Lexer::Lexer(std::string_view source, FileId file)
+    :source(source), file(file), startPosition(0), currentPosition(0),
+     symbols(SymbolTable::instance()), keywords(keywordsBySymbol()) {}
 
-Token Lexer::scanToken() {
+Token Lexer::next() {
 
     this->skipWhiteSpace();
 
@@ -101,7 +143,7 @@ Token Lexer::scanToken() {
             return this->stringLiteral();
         default:
             if(this->isAlpha(c))
-                return this->identifierLiteral(c);
+                return this->identifierLiteral();
             if(this->isDigit(c))
                 return this->numberLiteral();
             return this->errorToken("Bilinmeyen karakter");
@@ -109,19 +151,19 @@ Token Lexer::scanToken() {
 }
 
 Token Lexer::makeToken(TokenType type) {
-    return Token(type, this->fileName, &this->source[this->startPosition], this->currentPosition - this->startPosition, this->currentLine, this->currentColumn);
+    return Token(type, this->file, this->startPosition, this->currentPosition - this->startPosition);
 }
 
 Token Lexer::errorToken(const char* errMsg) {
-    return Token(TokenType::TOKEN_ERROR, this->fileName, errMsg, strlen(errMsg), this->currentLine, this->currentColumn);
+    // Hata mesajı sembol olarak taşınır, token hatalı kaynak aralığını gösterir
+    Symbol message = this->symbols.intern(errMsg, strlen(errMsg));
+    return Token(TokenType::TOKEN_ERROR, this->file, this->startPosition, this->currentPosition - this->startPosition, message);
 }
 
 Token Lexer::stringLiteral() {
     // Başlangıç tırnağından sonraki ilk karakteri işaretle
     int stringStart = this->currentPosition;
-    while(!this->isAtEnd() && this->peek() != '"') {
-        this->advance();
-    }
+    this->currentPosition = findByte(this->source, this->currentPosition, '"');
 
     // Tamamlanmayan string
     if(this->isAtEnd())
@@ -130,52 +172,23 @@ Token Lexer::stringLiteral() {
     // Son tırnağı da atla
     this->advance();
     // Token'ın start'ı baştaki tırnaktan bir sonraki karakter, length'i ise iki tırnak hariç uzunluk
-    return Token(TokenType::STRING_LITERAL, this->fileName, &this->source[stringStart], (this->currentPosition - stringStart) - 1, this->currentLine, this->currentColumn);
+    unsigned int length = (this->currentPosition - stringStart) - 1;
+    Symbol symbol = this->symbols.intern(&this->source[stringStart], length);
+    return Token(TokenType::STRING_LITERAL, this->file, stringStart, length, symbol);
 }
 
-Token Lexer::identifierLiteral(char start) {
-    std::stringstream lexeme;
-    lexeme << start;
-
-    while(this->isAlpha(this->peek()) || this->isDigit(this->peek()))
-        lexeme << this->advance();
-
-    std::string lexemeStr = lexeme.str();
-
-    if(lexemeStr == "metin")
-        return this->makeToken(TokenType::TYPE_STRING);
-    if(lexemeStr == "sayı")
-        return this->makeToken(TokenType::TYPE_NUMBER);
-    if(lexemeStr == "doğruluk")
-        return this->makeToken(TokenType::TYPE_BOOL);
-    if(lexemeStr == "doğru")
-        return this->makeToken(TokenType::TRUE);
-    if(lexemeStr == "yanlış")
-        return this->makeToken(TokenType::FALSE);
-    if(lexemeStr == "eğer")
-        return this->makeToken(TokenType::IF);
-    if(lexemeStr == "yoksa")
-        return this->makeToken(TokenType::ELSE);
-    if(lexemeStr == "döngü")
-        return this->makeToken(TokenType::LOOP);
-    if(lexemeStr == "deg")
-        return this->makeToken(TokenType::VAR);
-    if(lexemeStr == "sbt")
-        return this->makeToken(TokenType::CONST);
-    if(lexemeStr == "fonk")
-        return this->makeToken(TokenType::FUNCTION);
-    if(lexemeStr == "dön")
-        return this->makeToken(TokenType::RETURN);
-    if(lexemeStr == "eşle")
-        return this->makeToken(TokenType::SWITCH);
-    if(lexemeStr == "dur")
-        return this->makeToken(TokenType::BREAK);
-    if(lexemeStr == "devam")
-        return this->makeToken(TokenType::CONTINUE);
-    if(lexemeStr == "yaz")
-        return this->makeToken(TokenType::PRINT);
-
-    return this->makeToken(TokenType::IDENTIFIER);
+Token Lexer::identifierLiteral() {
+    // İlk karakter zaten okundu, kelime kaynak üzerinde kopyalanmadan eşleştirilir
+    this->currentPosition = skipIdentifier(this->source, this->currentPosition);
+
+    unsigned int length = this->currentPosition - this->startPosition;
+    Symbol symbol = this->symbols.intern(&this->source[this->startPosition], length);
+
+    // Anahtar kelime token'ları sembol taşımaz
+    if(symbol < this->keywords.size() && this->keywords[symbol] != TokenType::IDENTIFIER)
+        return this->makeToken(this->keywords[symbol]);
+
+    return Token(TokenType::IDENTIFIER, this->file, this->startPosition, length, symbol);
 }
 
 Token Lexer::numberLiteral() {
@@ -191,53 +204,48 @@ Token Lexer::numberLiteral() {
 
 void Lexer::skipWhiteSpace() {
     while(true) {
-        char c = this->peek();
-
-        switch(c) {
-            case ' ':
-            case '\t':
-            case '\r':
-                this->advance();
-                break;
-            case '\n':
-                this->currentLine++;
-                this->currentColumn = 0;
-                this->advance();
-                break;
-            
-            // Comment Lines
-            case '/':
-                if(this->nextPeek() == '/') {
-                    while(this->peek() != '\n' && !this->isAtEnd())
-                        this->advance();
-                    this->skipWhiteSpace();
-                } 
-                else if(this->nextPeek() == '*') {
-                    while(!(this->peek() == '*' && this->nextPeek() == '/') && !this->isAtEnd()) {
-                        char x = this->advance();
-                        if(x == '\n')
-                            this->currentLine++;
-                    }
-                    this->currentPosition += 2;
-                    this->skipWhiteSpace();
-                }
-            default:
-                return;
+        this->currentPosition = skipSpaces(this->source, this->currentPosition);
+
+        if(this->peek() != '/')
+            return;
+
+        // Comment Lines
+        if(this->nextPeek() == '/') {
+            this->currentPosition = findByte(this->source, this->currentPosition, '\n');
+        }
+        else if(this->nextPeek() == '*') {
+            this->currentPosition += 2;
+
+            while(true) {
+                this->currentPosition = findByte(this->source, this->currentPosition, '*');
+
+                if(this->isAtEnd())
+                    break;
+
+                this->currentPosition++;
+                if(this->isMatch('/'))
+                    break;
+            }
+        }
+        else {
+            return;
         }
     }
 }
 
 char Lexer::advance() {
-    this->currentColumn++;
     return this->source[this->currentPosition++];
 }
 
+// Kaynağın sonundan sonra okuma yapılmaz, '\0' döner
 char Lexer::peek() {
+    if(this->isAtEnd())
+        return '\0';
     return this->source[this->currentPosition];
 }
 
 char Lexer::nextPeek() {
-    if(this->isAtEnd())
+    if(this->currentPosition + 1 >= this->source.length())
         return '\0';
     return this->source[this->currentPosition+1];
 }
@@ -250,12 +258,11 @@ bool Lexer::isMatch(char c) {
 }
 
 bool Lexer::isAtEnd() {
-    return this->currentPosition == this->source.length();
+    return this->currentPosition >= this->source.length();
 }
 
 bool Lexer::isAlpha(char c) {
-    return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || c == '_' ||
-        std::string("çğıöşüÇĞİÖŞÜ").find(c) != std::string::npos;;
+    return IDENTIFIER_BYTES[static_cast<unsigned char>(c)];
 }
 
 bool Lexer::isDigit(char c) {
@@ -1,28 +1,29 @@
 #ifndef LEXER_HPP
 #define LEXER_HPP
 
+#include <string_view>
 #include <vector>
-#include <string>
 #include "../token/token.hpp"
 
 class Lexer {
 public:
-    Lexer(const std::string& source, const std::string& fileName);
-    std::vector<Token> scanner();
+    Lexer(std::string_view source, FileId file);
+
+    // Sıradaki token'ı üretir; kaynak bittiğinde hep TOKEN_EOF döner
+    Token next();
 
 private:
-    const std::string& source;
-    const std::string& fileName;
+    std::string_view source; // Sonunda '\0' olması beklenmez (ör. belleğe eşlenmiş dosya)
+    FileId file;
     unsigned int startPosition;
     unsigned int currentPosition;
-    unsigned int currentLine;
-    unsigned int currentColumn;
+    SymbolTable& symbols;
+    const std::vector<TokenType>& keywords; // Sembol numarasına göre anahtar kelime türü
 
-    Token scanToken();
     Token makeToken(TokenType type);
     Token errorToken(const char* errMsg);
     Token stringLiteral();
-    Token identifierLiteral(char start);
+    Token identifierLiteral();
     Token numberLiteral();
 
     void skipWhiteSpace();
@@ -0,0 +1,129 @@
+#include "scan.hpp"
+
+#include <cstring>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+    #define LEXER_SSE2 1
+    #include <emmintrin.h>
+    #ifdef _MSC_VER
+        #include <intrin.h>
+    #endif
+#endif
+
+#if LEXER_SSE2
+static inline unsigned int firstSetBit(unsigned int mask) {
+    #ifdef _MSC_VER
+        unsigned long index;
+        _BitScanForward(&index, mask);
+        return static_cast<unsigned int>(index);
+    #else
+        return static_cast<unsigned int>(__builtin_ctz(mask));
+    #endif
+}
+#endif
+
+static inline bool isSpace(char c) {
+    return c == ' ' || c == '\t' || c == '\r' || c == '\n';
+}
+
+static inline bool isIdentifierByte(char c) {
+    return IDENTIFIER_BYTES[static_cast<unsigned char>(c)] || (c >= '0' && c <= '9');
+}
+
+// Token'lar arasındaki boşluklar ve tanımlayıcılar çoğunlukla birkaç bayttır;
+// ilk baytlar vektör yolu kurulmadan tek tek denetlenir
+constexpr int SCALAR_PREFIX = 8;
+
+size_t skipSpaces(std::string_view source, size_t position) {
+    const char* data = source.data();
+    size_t size = source.size();
+
+    for(int i = 0; i < SCALAR_PREFIX; i++, position++) {
+        if(position >= size || !isSpace(data[position]))
+            return position;
+    }
+
+    #if LEXER_SSE2
+        const __m128i space = _mm_set1_epi8(' ');
+        const __m128i tab = _mm_set1_epi8('\t');
+        const __m128i carriage = _mm_set1_epi8('\r');
+        const __m128i newline = _mm_set1_epi8('\n');
+
+        while(position + 16 <= size) {
+            __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + position));
+            __m128i spaces = _mm_or_si128(
+                _mm_or_si128(_mm_cmpeq_epi8(chunk, space), _mm_cmpeq_epi8(chunk, tab)),
+                _mm_or_si128(_mm_cmpeq_epi8(chunk, carriage), _mm_cmpeq_epi8(chunk, newline)));
+
+            unsigned int mask = static_cast<unsigned int>(_mm_movemask_epi8(spaces)) ^ 0xFFFFu;
+            if(mask != 0)
+                return position + firstSetBit(mask);
+
+            position += 16;
+        }
+    #endif
+
+    while(position < size && isSpace(data[position]))
+        position++;
+
+    return position;
+}
+
+size_t skipIdentifier(std::string_view source, size_t position) {
+    const char* data = source.data();
+    size_t size = source.size();
+
+    for(int i = 0; i < SCALAR_PREFIX; i++, position++) {
+        if(position >= size || !isIdentifierByte(data[position]))
+            return position;
+    }
+
+    #if LEXER_SSE2
+        // ASCII harf, rakam ve '_' vektörle elenir. 0x80 üstü baytlar işaretli
+        // karşılaştırmada negatif kaldığından durdurur ve tabloyla kontrol edilir.
+        const __m128i caseBit = _mm_set1_epi8(0x20);
+        const __m128i beforeA = _mm_set1_epi8('a' - 1);
+        const __m128i afterZ = _mm_set1_epi8('z' + 1);
+        const __m128i before0 = _mm_set1_epi8('0' - 1);
+        const __m128i after9 = _mm_set1_epi8('9' + 1);
+        const __m128i underscore = _mm_set1_epi8('_');
+
+        while(position + 16 <= size) {
+            __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + position));
+            __m128i lower = _mm_or_si128(chunk, caseBit);
+
+            __m128i letters = _mm_and_si128(_mm_cmpgt_epi8(lower, beforeA), _mm_cmpgt_epi8(afterZ, lower));
+            __m128i digits = _mm_and_si128(_mm_cmpgt_epi8(chunk, before0), _mm_cmpgt_epi8(after9, chunk));
+            __m128i accepted = _mm_or_si128(_mm_or_si128(letters, digits), _mm_cmpeq_epi8(chunk, underscore));
+
+            unsigned int mask = static_cast<unsigned int>(_mm_movemask_epi8(accepted)) ^ 0xFFFFu;
+            if(mask == 0) {
+                position += 16;
+                continue;
+            }
+
+            position += firstSetBit(mask);
+            if(!IDENTIFIER_BYTES[static_cast<unsigned char>(data[position])])
+                return position;
+
+            position++;
+        }
+    #endif
+
+    while(position < size && isIdentifierByte(data[position]))
+        position++;
+
+    return position;
+}
+
+// memchr standart kütüphanede zaten vektörleştirilmiştir
+size_t findByte(std::string_view source, size_t position, char c) {
+    if(position >= source.size())
+        return source.size();
+
+    const void* found = std::memchr(source.data() + position, c, source.size() - position);
+    if(found == nullptr)
+        return source.size();
+
+    return static_cast<const char*>(found) - source.data();
+}
@@ -0,0 +1,40 @@
+#ifndef SCAN_HPP
+#define SCAN_HPP
+
+#include <array>
+#include <cstddef>
+#include <string_view>
+
+// Sözcük analizcisinin sıcak döngüleri için bayt tarama yardımcıları.
+// SSE2 bulunan derlemelerde 16 baytlık bloklar halinde, diğerlerinde
+// bayt bayt çalışır. Hepsi bulunamazsa kaynağın uzunluğunu döndürür.
+
+// Tanımlayıcıda geçebilen baytlar; Türkçe harflerin UTF-8 baytları dahil
+constexpr std::array<bool, 256> makeIdentifierTable() {
+    std::array<bool, 256> table = {};
+
+    for(int c = 'a'; c <= 'z'; c++)
+        table[c] = true;
+    for(int c = 'A'; c <= 'Z'; c++)
+        table[c] = true;
+    table['_'] = true;
+
+    std::string_view turkish = "çğıöşüÇĞİÖŞÜ";
+    for(char c : turkish)
+        table[static_cast<unsigned char>(c)] = true;
+
+    return table;
+}
+
+inline constexpr std::array<bool, 256> IDENTIFIER_BYTES = makeIdentifierTable();
+
+// İlk boşluk olmayan (' ', '\t', '\r', '\n') baytın konumu
+size_t skipSpaces(std::string_view source, size_t position);
+
+// Tanımlayıcı (harf, rakam, '_' veya Türkçe harf) olmayan ilk baytın konumu
+size_t skipIdentifier(std::string_view source, size_t position);
+
+// Verilen baytın ilk geçtiği konum
+size_t findByte(std::string_view source, size_t position, char c);
+
+#endif // SCAN_HPP
@@ -1,41 +1,95 @@
+#include <chrono>
 #include <iostream>
-#include <fstream>
-#include <sstream>
+#include "source/sourceBuffer.hpp"
 #include "lexer/lexer.hpp"
 #include "parser/parser.hpp"
 #include "ast/astPrinter.hpp"
+#include "optimizer/optimizer.hpp"
+#include "resolver/resolver.hpp"
 #include "interpreter/interpreter.hpp"
+#include "vm/vm.hpp"
+#include "output/outputBuffer.hpp"
 
 #define LEXER_TEST 0
 #define AST_TEST 0
 
-void run(const char* filePath) {
-    std::ifstream file(filePath);
+struct Options {
+    const char* filePath = nullptr;
+    bool treeWalker = false; // Referans ağaç yorumlayıcısı ile çalıştır
+    bool stats = false;      // Çalışma sonunda bellek istatistiklerini yaz
+    bool fold = true;        // Sabit katlama geçişini çalıştır
+    bool benchParse = false; // Yalnızca sözcük ve sözdizimi analizini ölç, çalıştırma
+    bool unbuffered = false; // 'yaz' çıktısını her satırda hemen yaz
+};
 
-    if(file.fail()) {
+// Önce yalnızca sözcük analizini, ardından ayrıştırmayla birlikte ölçer
+void benchmark(std::string_view source, FileId fileId) {
+    double megabytes = source.size() / (1024.0 * 1024.0);
+
+    auto lexStart = std::chrono::steady_clock::now();
+    size_t tokenCount = 0;
+
+    Lexer countingLexer(source, fileId);
+    while(countingLexer.next().type != TokenType::TOKEN_EOF)
+        tokenCount++;
+
+    std::chrono::duration<double> lexElapsed = std::chrono::steady_clock::now() - lexStart;
+    std::cerr << "[ÖLÇÜM] Sözcük analizi: " << megabytes << " MB kaynak, " << tokenCount << " token, "
+              << lexElapsed.count() * 1000 << " ms, " << megabytes / lexElapsed.count() << " MB/s" << std::endl;
+
+    auto parseStart = std::chrono::steady_clock::now();
+
+    Lexer lexer(source, fileId);
+    Parser parser(lexer);
+    std::unique_ptr<Program> program = parser.parse();
+
+    std::chrono::duration<double> parseElapsed = std::chrono::steady_clock::now() - parseStart;
+    std::cerr << "[ÖLÇÜM] Ayrıştırma: " << parseElapsed.count() * 1000 << " ms, "
+              << megabytes / parseElapsed.count() << " MB/s, AST: "
+              << program->arena->bytesUsed() / 1024 << " KB" << std::endl;
+
+    auto teardownStart = std::chrono::steady_clock::now();
+    program.reset();
+
+    std::chrono::duration<double> teardownElapsed = std::chrono::steady_clock::now() - teardownStart;
+    std::cerr << "[ÖLÇÜM] AST yıkımı: " << teardownElapsed.count() * 1000 << " ms" << std::endl;
+}
+
+void run(const Options& options) {
+    const char* filePath = options.filePath;
+
+    // Token'lar eşlenmiş sayfaları doğrudan gösterir, tampon çalıştırma boyunca yaşar
+    SourceBuffer buffer;
+
+    if(!buffer.open(filePath)) {
         std::cerr << "[HATA] " << filePath << "yolunda dosya bulunamadı." << std::endl;
         return;
     }
 
-    std::stringstream buffer;
-    buffer << file.rdbuf();
-    std::string source = buffer.str();
+    std::string_view source = buffer.text();
 
-    Lexer lexer(source, filePath);
-    std::vector<Token> tokens = lexer.scanner();
+    FileId fileId = SourceManager::instance().addFile(filePath, source);
+
+    if(options.benchParse) {
+        benchmark(source, fileId);
+        return;
+    }
 
     #if LEXER_TEST
-        for(const Token& token : tokens) {
+        Lexer testLexer(source, fileId);
+        for(Token token = testLexer.next(); token.type != TokenType::TOKEN_EOF; token = testLexer.next()) {
 
-            std::string str(token.start, token.length);
+            std::string str(token.lexeme());
+            SourceLocation location = token.location();
             std::cout
                     << ", Value: " << str
-                    << ", Line: " << token.line
-                    << ", Column: " << token.column << std::endl;
+                    << ", Line: " << location.line
+                    << ", Column: " << location.column << std::endl;
         }
     #endif
 
-    Parser parser(tokens);
+    Lexer lexer(source, fileId);
+    Parser parser(lexer);
     std::unique_ptr<Program> program = parser.parse();
 
     #if AST_TEST
@@ -49,8 +103,35 @@ void run(const char* filePath) {
         std::cout << "===== AST AĞACI BİTİŞ =====" << std::endl;
     #endif
 
-    Interpreter interpreter;
-    interpreter.interpret(program.get());
+    if(options.fold) {
+        Optimizer optimizer;
+        optimizer.optimize(program.get());
+
+        if(options.stats) {
+            const Optimizer::Statistics& stats = optimizer.statistics();
+            std::cerr << "[İSTATİSTİK] Katlanan ifade: " << stats.foldedExpressions
+                      << ", yayılan sabit: " << stats.propagatedConstants
+                      << ", atılan dal: " << stats.removedBranches << std::endl;
+        }
+    }
+
+    if(options.treeWalker) {
+        Resolver resolver;
+        resolver.resolve(program.get());
+
+        Interpreter interpreter;
+        interpreter.interpret(program.get());
+
+        if(options.stats) {
+            const Interpreter::Statistics& stats = interpreter.statistics();
+            std::cerr << "[İSTATİSTİK] Oluşturulan çevre: " << stats.environmentAllocations
+                      << ", yeniden kullanılan çevre: " << stats.environmentReuses << std::endl;
+        }
+        return;
+    }
+
+    VM vm;
+    vm.interpret(program.get());
 }
 
 int main(int argc, char* argv[]) {
@@ -61,12 +142,37 @@ int main(int argc, char* argv[]) {
 
     setlocale(LC_ALL, "tr_TR.UTF-8");
 
-    if(argc != 2) {
-        std::cerr << "[Hata] Geçersiz komut satırı argüman sayısı" << std::endl;
+    Options options;
+
+    for(int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+
+        if(arg == "--tree-walker")
+            options.treeWalker = true;
+        else if(arg == "--stats")
+            options.stats = true;
+        else if(arg == "--no-fold")
+            options.fold = false;
+        else if(arg == "--bench-parse")
+            options.benchParse = true;
+        else if(arg == "--unbuffered")
+            options.unbuffered = true;
+        else if(options.filePath == nullptr && arg.rfind("--", 0) != 0)
+            options.filePath = argv[i];
+        else {
+            std::cerr << "[Hata] Geçersiz komut satırı argümanı: " << arg << std::endl;
+            return 1;
+        }
+    }
+
+    if(options.filePath == nullptr) {
+        std::cerr << "[Hata] Kullanım: interpreter [--tree-walker] [--stats] [--no-fold] [--bench-parse] [--unbuffered] dosyaAdı" << std::endl;
         return 1;
     }
 
-    run(argv[1]);
+    OutputBuffer::instance().setUnbuffered(options.unbuffered);
+    run(options);
+    OutputBuffer::instance().flush();
 
     return 0;
 }
@@ -0,0 +1,377 @@
+#include "optimizer.hpp"
+
+#include <cmath>
+
+// Yorumlayıcının doğruluk ve eşitlik kuralları
+static bool isTruthy(const Value& value) {
+    if(value.isNil())
+        return false;
+
+    if(value.isBool())
+        return value.asBool();
+
+    return true;
+}
+
+static bool isEqual(const Value& a, const Value& b) {
+    if(a.isBool() && b.isBool())
+        return a.asBool() == b.asBool();
+
+    if(a.isNumber() && b.isNumber())
+        return a.asNumber() == b.asNumber();
+
+    if(a.isString() && b.isString())
+        return a.asString() == b.asString();
+
+    return false;
+}
+
+static bool declaresName(const NodePtr<Stmt>& stmt) {
+    return dynamic_cast<const VarDeclStmt*>(stmt.get()) != nullptr ||
+        dynamic_cast<const FunctionDeclStmt*>(stmt.get()) != nullptr;
+}
+
+static const LiteralExpression* asLiteral(const NodePtr<Expression>& expr) {
+    return dynamic_cast<const LiteralExpression*>(expr.get());
+}
+
+// İşlem çalışma zamanında hata verecekse false döner ve ifade katlanmaz
+static bool foldBinary(Operator operation, const Value& left, const Value& right, Value& result) {
+    if(operation == Operator::ADD) {
+        if(left.isNumber() && right.isNumber())
+            result = Value(left.asNumber() + right.asNumber());
+        else if(Value::canConcat(left, right)) {
+            // Sabit her çalıştırmada okunacağından hemen düzleştirilir
+            result = Value::concat(left, right);
+            result.asString();
+        } else {
+            return false;
+        }
+
+        return true;
+    }
+
+    if(!left.isNumber() || !right.isNumber())
+        return false;
+
+    double a = left.asNumber();
+    double b = right.asNumber();
+
+    switch(operation) {
+    case Operator::SUBTRACT:
+        result = Value(a - b);
+        return true;
+    case Operator::MULTIPLY:
+        result = Value(a * b);
+        return true;
+    case Operator::DIVIDE:
+        if(b == 0)
+            return false;
+        result = Value(a / b);
+        return true;
+    case Operator::MODULUS:
+        if(b == 0)
+            return false;
+        result = Value(fmod(a, b));
+        return true;
+    case Operator::POWER:
+        result = Value(pow(a, b));
+        return true;
+    default:
+        return false;
+    }
+}
+
+static bool foldComparison(Operator operation, const Value& left, const Value& right, Value& result) {
+    if(operation == Operator::EQUAL) {
+        result = Value(isEqual(left, right));
+        return true;
+    }
+
+    if(operation == Operator::NOT_EQUAL) {
+        result = Value(!isEqual(left, right));
+        return true;
+    }
+
+    if(!left.isNumber() || !right.isNumber())
+        return false;
+
+    double a = left.asNumber();
+    double b = right.asNumber();
+
+    switch(operation) {
+    case Operator::GREAT:
+        result = Value(a > b);
+        return true;
+    case Operator::GREAT_EQUAL:
+        result = Value(a >= b);
+        return true;
+    case Operator::LESS:
+        result = Value(a < b);
+        return true;
+    case Operator::LESS_EQUAL:
+        result = Value(a <= b);
+        return true;
+    default:
+        return false;
+    }
+}
+
+void Optimizer::optimize(Program* program) {
+    this->arena = program->arena.get();
+    this->scopes.clear();
+    this->stats = Statistics();
+
+    program->accept(*this);
+}
+
+const Optimizer::Statistics& Optimizer::statistics() const {
+    return this->stats;
+}
+
+void Optimizer::foldExpression(NodePtr<Expression>& expr) {
+    expr->accept(*this);
+
+    if(this->replacement != nullptr)
+        expr = std::move(this->replacement);
+}
+
+void Optimizer::foldStatement(NodePtr<Stmt>& stmt) {
+    stmt->accept(*this);
+
+    if(this->stmtReplacement != nullptr)
+        stmt = std::move(this->stmtReplacement);
+}
+
+// Dal veya gövde olarak kullanılan bir deyim silinemez, boş blokla değiştirilir
+void Optimizer::foldBranch(NodePtr<Stmt>& stmt) {
+    this->foldStatement(stmt);
+
+    if(this->removeStatement) {
+        this->removeStatement = false;
+        stmt = makeNode<BlockStmt>(*this->arena, std::vector<NodePtr<Stmt>>());
+    }
+}
+
+// Yalnızca doğrudan bir deyim listesinde tanımlanan 'sbt' değerleri yayılır;
+// koşullu tanımlar sadece ismi gölgeler
+void Optimizer::foldStatements(std::vector<NodePtr<Stmt>>& statements) {
+    size_t kept = 0;
+
+    for(size_t i = 0; i < statements.size(); i++) {
+        this->foldStatement(statements[i]);
+
+        if(this->removeStatement) {
+            this->removeStatement = false;
+            continue;
+        }
+
+        auto* decl = dynamic_cast<VarDeclStmt*>(statements[i].get());
+        if(decl != nullptr && decl->isConst && !decl->isArray && decl->initializer != nullptr) {
+            const LiteralExpression* literal = asLiteral(decl->initializer);
+            TokenType type = decl->type.type;
+
+            bool matches = literal != nullptr &&
+                ((type == TokenType::TYPE_NUMBER && literal->value.isNumber()) ||
+                 (type == TokenType::TYPE_STRING && literal->value.isString()) ||
+                 (type == TokenType::TYPE_BOOL && literal->value.isBool()));
+
+            if(matches)
+                this->scopes.back()[decl->name.symbol] = literal;
+        }
+
+        statements[kept++] = std::move(statements[i]);
+    }
+
+    statements.resize(kept);
+}
+
+void Optimizer::replaceWithLiteral(const Token& at, const Value& value) {
+    Token token = at;
+
+    if(value.isNumber())
+        token.type = TokenType::NUMBER_LITERAL;
+    else if(value.isString())
+        token.type = TokenType::STRING_LITERAL;
+    else
+        token.type = value.asBool() ? TokenType::TRUE : TokenType::FALSE;
+
+    this->replacement = makeNode<LiteralExpression>(*this->arena, token, value);
+    this->stats.foldedExpressions++;
+}
+
+void Optimizer::visitBinaryExpression(BinaryExpression* expr) {
+    this->foldExpression(expr->left);
+    this->foldExpression(expr->right);
+
+    const LiteralExpression* left = asLiteral(expr->left);
+    const LiteralExpression* right = asLiteral(expr->right);
+    if(left == nullptr || right == nullptr)
+        return;
+
+    Value result;
+    if(foldBinary(expr->operation, left->value, right->value, result))
+        this->replaceWithLiteral(expr->op, result);
+}
+
+void Optimizer::visitLogicalExpression(LogicalExpression* expr) {
+    this->foldExpression(expr->left);
+    this->foldExpression(expr->right);
+
+    const LiteralExpression* left = asLiteral(expr->left);
+    if(left == nullptr)
+        return;
+
+    // Sol taraf sonucu belirliyorsa kendisi, belirlemiyorsa sağ taraf kalır
+    bool truthy = isTruthy(left->value);
+    bool decided = expr->operation == Operator::AND ? !truthy : truthy;
+
+    this->replacement = decided ? std::move(expr->left) : std::move(expr->right);
+    this->stats.foldedExpressions++;
+}
+
+void Optimizer::visitUnaryExpression(UnaryExpression* expr) {
+    this->foldExpression(expr->operand);
+
+    const LiteralExpression* operand = asLiteral(expr->operand);
+    if(operand == nullptr)
+        return;
+
+    if(expr->operation == Operator::NOT)
+        this->replaceWithLiteral(expr->op, Value(!isTruthy(operand->value)));
+    else if(operand->value.isNumber())
+        this->replaceWithLiteral(expr->op, Value(-operand->value.asNumber()));
+}
+
+void Optimizer::visitComparisonExpression(ComparisonExpression* expr) {
+    this->foldExpression(expr->left);
+    this->foldExpression(expr->right);
+
+    const LiteralExpression* left = asLiteral(expr->left);
+    const LiteralExpression* right = asLiteral(expr->right);
+    if(left == nullptr || right == nullptr)
+        return;
+
+    Value result;
+    if(foldComparison(expr->operation, left->value, right->value, result))
+        this->replaceWithLiteral(expr->op, result);
+}
+
+void Optimizer::visitLiteralExpression(LiteralExpression* expr) {}
+
+void Optimizer::visitVariableExpression(VariableExpression* expr) {
+    for(auto scope = this->scopes.rbegin(); scope != this->scopes.rend(); ++scope) {
+        auto it = scope->find(expr->name.symbol);
+        if(it == scope->end())
+            continue;
+
+        if(it->second != nullptr) {
+            this->replacement = makeNode<LiteralExpression>(*this->arena, it->second->token, it->second->value);
+            this->stats.propagatedConstants++;
+        }
+        return;
+    }
+}
+
+void Optimizer::visitAssignExpression(AssignExpression* expr) {
+    this->foldExpression(expr->value);
+}
+
+void Optimizer::visitCallExpression(CallExpression* expr) {
+    for(auto& arg : expr->arguments)
+        this->foldExpression(arg);
+}
+
+void Optimizer::visitArrayExpression(ArrayExpression* expr) {
+    for(auto& element : expr->elements)
+        this->foldExpression(element);
+}
+
+void Optimizer::visitArrayAccessExpression(ArrayAccessExpression* expr) {
+    this->foldExpression(expr->array);
+    this->foldExpression(expr->index);
+}
+
+void Optimizer::visitArrayAssignExpression(ArrayAssignExpression* expr) {
+    for(auto& index : expr->indices)
+        this->foldExpression(index);
+
+    this->foldExpression(expr->value);
+}
+
+void Optimizer::visitExpressionStmt(ExpressionStmt* stmt) {
+    this->foldExpression(stmt->expression);
+}
+
+void Optimizer::visitPrintStmt(PrintStmt* stmt) {
+    this->foldExpression(stmt->expression);
+}
+
+void Optimizer::visitVarDeclStmt(VarDeclStmt* stmt) {
+    if(stmt->initializer != nullptr)
+        this->foldExpression(stmt->initializer);
+
+    this->scopes.back()[stmt->name.symbol] = nullptr;
+}
+
+void Optimizer::visitBlockStmt(BlockStmt* stmt) {
+    this->scopes.emplace_back();
+    this->foldStatements(stmt->statements);
+    this->scopes.pop_back();
+}
+
+void Optimizer::visitIfStmt(IfStmt* stmt) {
+    this->foldExpression(stmt->condition);
+    this->foldBranch(stmt->thenBranch);
+
+    if(stmt->elseBranch != nullptr)
+        this->foldBranch(stmt->elseBranch);
+
+    const LiteralExpression* condition = asLiteral(stmt->condition);
+    if(condition == nullptr)
+        return;
+
+    // Dallardan biri bir isim tanımlıyorsa kapsamı değişmesin diye dokunulmaz
+    if(declaresName(stmt->thenBranch) || declaresName(stmt->elseBranch))
+        return;
+
+    bool truthy = isTruthy(condition->value);
+    NodePtr<Stmt>& taken = truthy ? stmt->thenBranch : stmt->elseBranch;
+
+    this->stats.removedBranches++;
+
+    if(taken != nullptr)
+        this->stmtReplacement = std::move(taken);
+    else
+        this->removeStatement = true;
+}
+
+void Optimizer::visitLoopStmt(LoopStmt* stmt) {
+    this->foldExpression(stmt->condition);
+    this->foldBranch(stmt->body);
+}
+
+void Optimizer::visitBreakStmt(BreakStmt* stmt) {}
+
+void Optimizer::visitContinueStmt(ContinueStmt* stmt) {}
+
+void Optimizer::visitFunctionDeclStmt(FunctionDeclStmt* stmt) {
+    this->scopes.emplace_back();
+
+    for(const Token& param : stmt->paramNames)
+        this->scopes.back()[param.symbol] = nullptr;
+
+    this->visitBlockStmt(stmt->body.get());
+    this->scopes.pop_back();
+}
+
+void Optimizer::visitReturnStmt(ReturnStmt* stmt) {
+    if(stmt->value != nullptr)
+        this->foldExpression(stmt->value);
+}
+
+void Optimizer::visitProgram(Program* program) {
+    this->scopes.emplace_back();
+    this->foldStatements(program->statements);
+    this->scopes.pop_back();
+}
@@ -0,0 +1,67 @@
+#ifndef OPTIMIZER_HPP
+#define OPTIMIZER_HPP
+
+#include <memory>
+#include <unordered_map>
+#include <vector>
+#include "../ast/ast.hpp"
+
+// Çözümlemeden önce AST üzerinde çalışan sabit katlama geçişi.
+// Sabit alt ifadeler tek bir sabite indirgenir, sabit değerli 'sbt'
+// tanımları kullanıldıkları yere yayılır ve koşulu sabit olan 'eğer'
+// deyimlerinin ölü dalları atılır. Çalışma zamanında hata verecek
+// ifadeler (sıfıra bölme, tip uyuşmazlığı) olduğu gibi bırakılır.
+class Optimizer : public ASTVisitor {
+public:
+    struct Statistics {
+        size_t foldedExpressions = 0;
+        size_t propagatedConstants = 0;
+        size_t removedBranches = 0;
+    };
+
+    void optimize(Program* program);
+    const Statistics& statistics() const;
+
+private:
+    // nullptr değer, ismin sabit olmayan bir tanımla gölgelendiğini gösterir
+    using Scope = std::unordered_map<Symbol, const LiteralExpression*>;
+
+    Arena* arena = nullptr; // Yeni düğümler programın Arena'sında oluşturulur
+    std::vector<Scope> scopes;
+    NodePtr<Expression> replacement;
+    NodePtr<Stmt> stmtReplacement;
+    bool removeStatement = false;
+    Statistics stats;
+
+    void foldExpression(NodePtr<Expression>& expr);
+    void foldStatement(NodePtr<Stmt>& stmt);
+    void foldBranch(NodePtr<Stmt>& stmt);
+    void foldStatements(std::vector<NodePtr<Stmt>>& statements);
+    void replaceWithLiteral(const Token& at, const Value& value);
+
+    void visitBinaryExpression(BinaryExpression* expr) override;
+    void visitLogicalExpression(LogicalExpression* expr) override;
+    void visitUnaryExpression(UnaryExpression* expr) override;
+    void visitComparisonExpression(ComparisonExpression* expr) override;
+    void visitLiteralExpression(LiteralExpression* expr) override;
+    void visitVariableExpression(VariableExpression* expr) override;
+    void visitAssignExpression(AssignExpression* expr) override;
+    void visitCallExpression(CallExpression* expr) override;
+    void visitArrayExpression(ArrayExpression* expr) override;
+    void visitArrayAccessExpression(ArrayAccessExpression* expr) override;
+    void visitArrayAssignExpression(ArrayAssignExpression* expr) override;
+
+    void visitExpressionStmt(ExpressionStmt* stmt) override;
+    void visitPrintStmt(PrintStmt* stmt) override;
+    void visitVarDeclStmt(VarDeclStmt* stmt) override;
+    void visitBlockStmt(BlockStmt* stmt) override;
+    void visitIfStmt(IfStmt* stmt) override;
+    void visitLoopStmt(LoopStmt* stmt) override;
+    void visitBreakStmt(BreakStmt* stmt) override;
+    void visitContinueStmt(ContinueStmt* stmt) override;
+    void visitFunctionDeclStmt(FunctionDeclStmt* stmt) override;
+    void visitReturnStmt(ReturnStmt* stmt) override;
+    void visitProgram(Program* program) override;
+};
+
+#endif // OPTIMIZER_HPP
@@ -0,0 +1,47 @@
+#include "outputBuffer.hpp"
+
+#include <cstdio>
+
+#ifdef _WIN32
+    #include <io.h>
+    #define isatty _isatty
+    #define fileno _fileno
+#else
+    #include <unistd.h>
+#endif
+
+OutputBuffer& OutputBuffer::instance() {
+    static OutputBuffer output;
+    return output;
+}
+
+OutputBuffer::OutputBuffer()
+    : stdoutIsTerminal(isatty(fileno(stdout))) {
+    this->lineFlush = this->stdoutIsTerminal;
+    this->buffer.reserve(CAPACITY);
+}
+
+OutputBuffer::~OutputBuffer() {
+    this->flush();
+}
+
+void OutputBuffer::setUnbuffered(bool unbuffered) {
+    this->lineFlush = unbuffered || this->stdoutIsTerminal;
+}
+
+void OutputBuffer::printLine(const Value& value) {
+    value.appendTo(this->buffer);
+    this->buffer += '\n';
+
+    if(this->lineFlush || this->buffer.size() >= CAPACITY)
+        this->flush();
+}
+
+void OutputBuffer::flush() {
+    if(!this->buffer.empty()) {
+        std::fwrite(this->buffer.data(), 1, this->buffer.size(), stdout);
+        this->buffer.clear();
+    }
+
+    std::fflush(stdout);
+}
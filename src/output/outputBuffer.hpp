@@ -0,0 +1,32 @@
+#ifndef OUTPUT_BUFFER_HPP
+#define OUTPUT_BUFFER_HPP
+
+#include <string>
+#include "../interpreter/value.hpp"
+
+// 'yaz' çıktısını biriktirip standart çıktıya toplu halde yazar. Tampon
+// dolduğunda, program bittiğinde ve hata mesajından önce boşaltılır.
+// Standart çıktı bir terminalse veya tamponsuz mod seçildiyse her satır
+// hemen yazılır.
+class OutputBuffer {
+public:
+    static OutputBuffer& instance();
+
+    void setUnbuffered(bool unbuffered);
+
+    // Değer ara metin oluşturmadan doğrudan tampona biçimlenir
+    void printLine(const Value& value);
+    void flush();
+
+private:
+    static constexpr size_t CAPACITY = 64 * 1024;
+
+    OutputBuffer();
+    ~OutputBuffer();
+
+    std::string buffer;
+    bool stdoutIsTerminal;
+    bool lineFlush;
+};
+
+#endif // OUTPUT_BUFFER_HPP
@@ -1,12 +1,15 @@
 #include "parser.hpp"
 
+#include <algorithm>
 #include <iostream>
 
-Parser::Parser(const std::vector<Token>& tokens)
-    : tokens(tokens), currentToken(0), hasError(false) {}
+Parser::Parser(Lexer& lexer)
+    : lexer(lexer), arena(std::make_unique<Arena>()), hasError(false) {
+    this->currentToken = this->lexer.next();
+}
 
 std::unique_ptr<Program> Parser::parse() {
-    std::vector<std::unique_ptr<Stmt>> statements;
+    std::vector<NodePtr<Stmt>> statements;
 
     while(!this->isAtEnd() && !this->hasError) {
         try {
@@ -17,12 +20,12 @@ std::unique_ptr<Program> Parser::parse() {
     }
 
     if(this->hasError)
-        return std::make_unique<Program>(std::vector<std::unique_ptr<Stmt>>());
+        return std::make_unique<Program>(std::move(this->arena), std::vector<NodePtr<Stmt>>());
 
-    return std::make_unique<Program>(std::move(statements));
+    return std::make_unique<Program>(std::move(this->arena), std::move(statements));
 }
 
-std::unique_ptr<Stmt> Parser::statement() {
+NodePtr<Stmt> Parser::statement() {
     if(this->match(TokenType::PRINT))
         return this->printStatement();
 
@@ -54,93 +57,102 @@ std::unique_ptr<Stmt> Parser::statement() {
     return expressionStatement();
 }
 
-std::unique_ptr<Stmt> Parser::printStatement() {
-    std::unique_ptr<Expression> value = this->expression(); // Ekrana yazılacak değer
+NodePtr<Stmt> Parser::printStatement() {
+    NodePtr<Expression> value = this->expression(); // Ekrana yazılacak değer
 
     this->match(TokenType::SEMI_COLON);
 
-    return std::make_unique<PrintStmt>(std::move(value));
+    return makeNode<PrintStmt>(*this->arena, std::move(value));
 }
 
-std::unique_ptr<Stmt> Parser::expressionStatement() {
-    std::unique_ptr<Expression> value = this->expression();
+NodePtr<Stmt> Parser::expressionStatement() {
+    NodePtr<Expression> value = this->expression();
 
     this->match(TokenType::SEMI_COLON);
 
-    return std::make_unique<ExpressionStmt>(std::move(value));
+    return makeNode<ExpressionStmt>(*this->arena, std::move(value));
 }
 
-std::unique_ptr<Stmt> Parser::blockStatement() {
-    std::vector<std::unique_ptr<Stmt>> statements;
+NodePtr<Stmt> Parser::blockStatement() {
+    std::vector<NodePtr<Stmt>> statements;
 
     while(!this->check(TokenType::BRACKET_CURLY_RIGHT) && !this->isAtEnd())
         statements.push_back(this->statement());
 
     consume(TokenType::BRACKET_CURLY_RIGHT, "Blok sonunda '}' bekleniyor.");
 
-    return std::make_unique<BlockStmt>(std::move(statements));
+    return makeNode<BlockStmt>(*this->arena, std::move(statements));
+}
+
+// Süslü parantezsiz bir gövde tanım olamaz; aksi halde tanımın hangi
+// kapsama ait olduğu koşula ve çalıştırma moduna göre değişirdi
+NodePtr<Stmt> Parser::branchStatement() {
+    if(this->check(TokenType::VAR) || this->check(TokenType::CONST) || this->check(TokenType::FUNCTION))
+        this->error(this->peek(), "Koşul veya döngü gövdesinde tanım yapılacaksa gövde '{ }' içine alınmalıdır.");
+
+    return this->statement();
 }
 
-std::unique_ptr<Stmt> Parser::ifStatement() {
+NodePtr<Stmt> Parser::ifStatement() {
     bool hasParentheses = this->match(TokenType::BRACKET_ROUND_LEFT); // koşul parantezi
 
-    std::unique_ptr<Expression> condition = this->expression();
+    NodePtr<Expression> condition = this->expression();
 
     if(hasParentheses)
         this->consume(TokenType::BRACKET_ROUND_RIGHT, "Koşul sonunda ')' bekleniyor.");
 
 
-    std::unique_ptr<Stmt> thenBranch = this->statement();
+    NodePtr<Stmt> thenBranch = this->branchStatement();
 
-    std::unique_ptr<Stmt> elseBranch = nullptr;
+    NodePtr<Stmt> elseBranch = nullptr;
     if(this->match(TokenType::ELSE))
-        elseBranch = this->statement();
+        elseBranch = this->branchStatement();
 
-    return std::make_unique<IfStmt>(std::move(condition), std::move(thenBranch), std::move(elseBranch));
+    return makeNode<IfStmt>(*this->arena, std::move(condition), std::move(thenBranch), std::move(elseBranch));
 }
 
-std::unique_ptr<Stmt> Parser::loopStatement() {
+NodePtr<Stmt> Parser::loopStatement() {
     bool hasParentheses = this->match(TokenType::BRACKET_ROUND_LEFT);
 
-    std::unique_ptr<Expression> condition = this->expression();
+    NodePtr<Expression> condition = this->expression();
 
     if (hasParentheses)
         this->consume(TokenType::BRACKET_ROUND_RIGHT, "Döngü koşulu sonunda ')' bekleniyor.");
 
-    std::unique_ptr<Stmt> body = this->statement();
+    NodePtr<Stmt> body = this->branchStatement();
 
-    return std::make_unique<LoopStmt>(std::move(condition), std::move(body));
+    return makeNode<LoopStmt>(*this->arena, std::move(condition), std::move(body));
 }
 
-std::unique_ptr<Stmt> Parser::breakStatement() {
+NodePtr<Stmt> Parser::breakStatement() {
     Token keyword = this->previous();
 
     this->match(TokenType::SEMI_COLON);
 
-    return std::make_unique<BreakStmt>(keyword);
+    return makeNode<BreakStmt>(*this->arena, keyword);
 }
 
-std::unique_ptr<Stmt> Parser::continueStatement() {
+NodePtr<Stmt> Parser::continueStatement() {
     Token keyword = this->previous();
 
     this->match(TokenType::SEMI_COLON);
 
-    return std::make_unique<ContinueStmt>(keyword);
+    return makeNode<ContinueStmt>(*this->arena, keyword);
 }
 
-std::unique_ptr<Stmt> Parser::returnStatement() {
+NodePtr<Stmt> Parser::returnStatement() {
     Token keyword = this->previous();
-    std::unique_ptr<Expression> value = nullptr;
+    NodePtr<Expression> value = nullptr;
 
     if(!this->check(TokenType::SEMI_COLON))
         value = this->expression();
 
         this->match(TokenType::SEMI_COLON);
 
-    return std::make_unique<ReturnStmt>(keyword, std::move(value));
+    return makeNode<ReturnStmt>(*this->arena, keyword, std::move(value));
 }
 
-std::unique_ptr<Stmt> Parser::varDeclaration() {
+NodePtr<Stmt> Parser::varDeclaration() {
     bool isConst = this->previous().type == TokenType::CONST;
 
     Token name = this->consume(TokenType::IDENTIFIER, "Değişken adı bekleniyor");
@@ -162,7 +174,7 @@ std::unique_ptr<Stmt> Parser::varDeclaration() {
         arrayDimensions++;
     }
 
-    std::unique_ptr<Expression> initializer = nullptr;
+    NodePtr<Expression> initializer = nullptr;
 
     if(this->match(TokenType::EQUAL)) {
         if(isArray && this->check(TokenType::BRACKET_SQUARE_LEFT))
@@ -173,10 +185,10 @@ std::unique_ptr<Stmt> Parser::varDeclaration() {
 
     this->match(TokenType::SEMI_COLON);
 
-    return std::make_unique<VarDeclStmt>(name, type, isArray, isConst, std::move(initializer));
+    return makeNode<VarDeclStmt>(*this->arena, name, type, isArray, isConst, std::move(initializer));
 }
 
-std::unique_ptr<Stmt> Parser::functionDeclaration() {
+NodePtr<Stmt> Parser::functionDeclaration() {
     Token name = this->consume(TokenType::IDENTIFIER, "Fonksiyon adı bekleniyor");
 
     Token returnType;
@@ -191,10 +203,19 @@ std::unique_ptr<Stmt> Parser::functionDeclaration() {
 
     std::vector<Token> paramNames;
     std::vector<Token> paramTypes;
+    std::vector<ValueType> paramValueTypes;
 
     if(!this->check(TokenType::BRACKET_CURLY_LEFT)) {
         do {
-            paramNames.push_back(this->consume(TokenType::IDENTIFIER, "Parametre adı bekleniyor."));
+            Token paramName = this->consume(TokenType::IDENTIFIER, "Parametre adı bekleniyor.");
+
+            // Tekrarlanan parametre adı her iki motor için burada reddedilir
+            for(const Token& param : paramNames) {
+                if(param.symbol == paramName.symbol)
+                    this->error(paramName, "Bu isimde bir parametre zaten tanımlı.");
+            }
+
+            paramNames.push_back(paramName);
 
             this->consume(TokenType::COLON, "Parametre adından sonra ':' bekleniyor.");
 
@@ -203,73 +224,96 @@ std::unique_ptr<Stmt> Parser::functionDeclaration() {
             else
                 this->error(this->peek(), "Geçerli bir parametre tipi bekleniyor (metin, sayı, doğruluk).");
 
-            if (match(TokenType::BRACKET_SQUARE_LEFT)) {
-                Token& lastType = paramTypes.back();
-                std::string newTypeName = std::string(lastType.start, lastType.length) + "[]";
-
+            bool isArray = this->match(TokenType::BRACKET_SQUARE_LEFT);
+            if (isArray)
                 this->consume(TokenType::BRACKET_SQUARE_RIGHT, "Dizi parametresinde ']' bekleniyor.");
-            }
+
+            paramValueTypes.push_back(toValueType(paramTypes.back().type, isArray));
 
         } while(this->match(TokenType::COMMA));
     }
 
     this->consume(TokenType::BRACKET_CURLY_LEFT, "Fonksiyon parametrelerinden sonra '{' bekleniyor.");
 
-    auto body = std::unique_ptr<BlockStmt>(static_cast<BlockStmt*>(this->blockStatement().release()));
+    auto body = NodePtr<BlockStmt>(static_cast<BlockStmt*>(this->blockStatement().release()));
 
-    return std::make_unique<FunctionDeclStmt>(name, returnType, std::move(paramNames), std::move(paramTypes), std::move(body));
+    return makeNode<FunctionDeclStmt>(*this->arena, name, returnType, std::move(paramNames), std::move(paramTypes), std::move(paramValueTypes), std::move(body));
 }
 
 
+// Sabitin değeri burada bir kez üretilir, değerlendirme sırasında dönüşüm yapılmaz
+NodePtr<Expression> Parser::literal(const Token& token) {
+    switch(token.type) {
+    case TokenType::NUMBER_LITERAL:
+        return makeNode<LiteralExpression>(*this->arena, token, Value(std::stod(std::string(token.lexeme()))));
+    case TokenType::STRING_LITERAL: {
+        auto it = this->stringConstants.find(token.symbol);
+        if(it == this->stringConstants.end())
+            it = this->stringConstants.emplace(token.symbol, Value(SymbolTable::instance().name(token.symbol))).first;
+        return makeNode<LiteralExpression>(*this->arena, token, it->second);
+    }
+    case TokenType::TRUE:
+        return makeNode<LiteralExpression>(*this->arena, token, Value(true));
+    default:
+        return makeNode<LiteralExpression>(*this->arena, token, Value(false));
+    }
+}
+
 ///// EXPRESSION METOTLARI /////
-std::unique_ptr<Expression> Parser::expression() {
+NodePtr<Expression> Parser::expression() {
     return this->assignment();
 }
 
-std::unique_ptr<Expression> Parser::assignment() {
-    std::unique_ptr<Expression> expression = this->logicalOr();
+NodePtr<Expression> Parser::assignment() {
+    NodePtr<Expression> expression = this->logicalOr();
 
     if(this->match({TokenType::EQUAL, TokenType::PLUS_EQUAL, TokenType::MINUS_EQUAL, TokenType::MULTIPLY_EQUAL, TokenType::DIVIDE_EQUAL})) {
         Token equals = this->previous();
-        std::unique_ptr<Expression> value = this->assignment();
+        NodePtr<Expression> value = this->assignment();
+
+        // Bileşik atamalarda token temel işleme çevrilir
+        Token op = equals;
+        switch(equals.type) {
+        case TokenType::PLUS_EQUAL:
+            op.type = TokenType::PLUS;
+            break;
+        case TokenType::MINUS_EQUAL:
+            op.type = TokenType::MINUS;
+            break;
+        case TokenType::MULTIPLY_EQUAL:
+            op.type = TokenType::MULTIPLY;
+            break;
+        case TokenType::DIVIDE_EQUAL:
+            op.type = TokenType::DIVIDE;
+            break;
+        default:
+            break;
+        }
 
         if (VariableExpression* varExpr = dynamic_cast<VariableExpression*>(expression.get())) {
             Token name = varExpr->name;
 
             if (equals.type != TokenType::EQUAL) {
-                std::unique_ptr<Expression> left = std::make_unique<VariableExpression>(name);
-                Token op = equals; // Mevcut token'ı kopyala
-
-                // Sadece tipini değiştir
-                switch(equals.type) {
-                case TokenType::PLUS_EQUAL:
-                    op.type = TokenType::PLUS;
-                    break;
-                case TokenType::MINUS_EQUAL:
-                    op.type = TokenType::MINUS;
-                    break;
-                case TokenType::MULTIPLY_EQUAL:
-                    op.type = TokenType::MULTIPLY;
-                    break;
-                case TokenType::DIVIDE_EQUAL:
-                    op.type = TokenType::DIVIDE;
-                    break;
-                default:
-                    break;
-                }
-
-                value = std::make_unique<BinaryExpression>(op, std::move(left), std::move(value));
+                NodePtr<Expression> left = makeNode<VariableExpression>(*this->arena, name);
+                value = makeNode<BinaryExpression>(*this->arena, op, std::move(left), std::move(value));
             }
 
-            return std::make_unique<AssignExpression>(name, std::move(value));
+            return makeNode<AssignExpression>(*this->arena, name, std::move(value));
         }
 
-        if (auto* arrayAccessExpr = dynamic_cast<ArrayAccessExpression*>(expression.get())) {
-            return std::make_unique<ArrayAssignExpression>(
-                std::move(arrayAccessExpr->array),
-                std::move(arrayAccessExpr->index),
-                std::move(value)
-            );
+        // a[i][j] zinciri kök değişkene kadar açılır, indeksler kökten başlayarak sıralanır
+        std::vector<NodePtr<Expression>> indices;
+        Expression* target = expression.get();
+
+        while (auto* arrayAccessExpr = dynamic_cast<ArrayAccessExpression*>(target)) {
+            indices.push_back(std::move(arrayAccessExpr->index));
+            target = arrayAccessExpr->array.get();
+        }
+
+        VariableExpression* root = dynamic_cast<VariableExpression*>(target);
+        if (!indices.empty() && root != nullptr) {
+            std::reverse(indices.begin(), indices.end());
+            return makeNode<ArrayAssignExpression>(*this->arena, root->name, std::move(indices), op, std::move(value));
         }
 
         this->error(equals, "Geçersiz atama hedefi.");
@@ -278,103 +322,103 @@ std::unique_ptr<Expression> Parser::assignment() {
     return expression;
 }
 
-std::unique_ptr<Expression> Parser::logicalOr() {
-    std::unique_ptr<Expression> expression = this->logicalAnd();
+NodePtr<Expression> Parser::logicalOr() {
+    NodePtr<Expression> expression = this->logicalAnd();
 
     while(this->match(TokenType::OR)) {
         Token op = this->previous();
-        std::unique_ptr<Expression> right = this->logicalAnd();
-        expression = std::make_unique<LogicalExpression>(op, std::move(expression), std::move(right));
+        NodePtr<Expression> right = this->logicalAnd();
+        expression = makeNode<LogicalExpression>(*this->arena, op, std::move(expression), std::move(right));
     }
 
     return expression;
 }
 
-std::unique_ptr<Expression> Parser::logicalAnd() {
-    std::unique_ptr<Expression> expression = this->equality();
+NodePtr<Expression> Parser::logicalAnd() {
+    NodePtr<Expression> expression = this->equality();
 
     while(this->match(TokenType::AND)) {
         Token op = this->previous();
-        std::unique_ptr<Expression> right = this->equality();
-        expression = std::make_unique<LogicalExpression>(op, std::move(expression), std::move(right));
+        NodePtr<Expression> right = this->equality();
+        expression = makeNode<LogicalExpression>(*this->arena, op, std::move(expression), std::move(right));
     }
 
     return expression;
 }
 
-std::unique_ptr<Expression> Parser::equality() {
-    std::unique_ptr<Expression> expression = this->comparison();
+NodePtr<Expression> Parser::equality() {
+    NodePtr<Expression> expression = this->comparison();
 
     while(this->match({TokenType::EQUAL_EQUAL, TokenType::BANG_EQUAL})) {
         Token op = this->previous();
-        std::unique_ptr<Expression> right = this->comparison();
-        expression = std::make_unique<ComparisonExpression>(op, std::move(expression), std::move(right));
+        NodePtr<Expression> right = this->comparison();
+        expression = makeNode<ComparisonExpression>(*this->arena, op, std::move(expression), std::move(right));
     }
 
     return expression;
 }
 
-std::unique_ptr<Expression> Parser::comparison() {
-    std::unique_ptr<Expression> expression = this->term();
+NodePtr<Expression> Parser::comparison() {
+    NodePtr<Expression> expression = this->term();
 
     while(this->match({TokenType::LESS, TokenType::LESS_EQUAL, TokenType::GREAT, TokenType::GREAT_EQUAL})) {
         Token op = this->previous();
-        std::unique_ptr<Expression> right = this->term();
-        expression = std::make_unique<ComparisonExpression>(op, std::move(expression), std::move(right));
+        NodePtr<Expression> right = this->term();
+        expression = makeNode<ComparisonExpression>(*this->arena, op, std::move(expression), std::move(right));
     }
 
     return expression;
 }
 
-std::unique_ptr<Expression> Parser::term() {
-    std::unique_ptr<Expression> expression = this->factor();
+NodePtr<Expression> Parser::term() {
+    NodePtr<Expression> expression = this->factor();
 
     while(this->match({TokenType::PLUS, TokenType::MINUS})) {
         Token op = this->previous();
-        std::unique_ptr<Expression> right = this->factor();
-        expression = std::make_unique<BinaryExpression>(op, std::move(expression), std::move(right));
+        NodePtr<Expression> right = this->factor();
+        expression = makeNode<BinaryExpression>(*this->arena, op, std::move(expression), std::move(right));
     }
 
     return expression;
 }
 
-std::unique_ptr<Expression> Parser::factor() {
-    std::unique_ptr<Expression> expression = this->power();
+NodePtr<Expression> Parser::factor() {
+    NodePtr<Expression> expression = this->power();
 
     while(this->match({TokenType::MULTIPLY, TokenType::DIVIDE, TokenType::MODULUS})) {
         Token op = this->previous();
-        std::unique_ptr<Expression> right = this->power();
-        expression = std::make_unique<BinaryExpression>(op, std::move(expression), std::move(right));
+        NodePtr<Expression> right = this->power();
+        expression = makeNode<BinaryExpression>(*this->arena, op, std::move(expression), std::move(right));
     }
 
     return expression;
 }
 
-std::unique_ptr<Expression> Parser::power() {
-    std::unique_ptr<Expression> expression = this->unary();
+NodePtr<Expression> Parser::power() {
+    NodePtr<Expression> expression = this->unary();
 
     while(this->match(TokenType::POWER)) {
         Token op = this->previous();
-        std::unique_ptr<Expression> right = this->unary();
-        expression = std::make_unique<BinaryExpression>(op, std::move(expression), std::move(right));
+        NodePtr<Expression> right = this->unary();
+        expression = makeNode<BinaryExpression>(*this->arena, op, std::move(expression), std::move(right));
     }
 
     return expression;
 }
 
-std::unique_ptr<Expression> Parser::unary() {
+NodePtr<Expression> Parser::unary() {
     if(this->match({TokenType::MINUS, TokenType::BANG})) {
         Token op = this->previous();
-        std::unique_ptr<Expression> right = this->unary();
+        NodePtr<Expression> right = this->unary();
 
-        return std::make_unique<UnaryExpression>(op, std::move(right));
+        return makeNode<UnaryExpression>(*this->arena, op, std::move(right));
     }
 
     return this->call();
 }
 
-std::unique_ptr<Expression> Parser::call() {
-    std::unique_ptr<Expression> expression = this->primary();
+NodePtr<Expression> Parser::call() {
+    NodePtr<Expression> expression = this->primary();
 
     while(true) {
         if(this->match(TokenType::BRACKET_ROUND_LEFT))
@@ -388,8 +432,8 @@ std::unique_ptr<Expression> Parser::call() {
     return expression;
 }
 
-std::unique_ptr<Expression> Parser::finishCall(std::unique_ptr<Expression> callee) {
-    std::vector<std::unique_ptr<Expression>> arguments;
+NodePtr<Expression> Parser::finishCall(NodePtr<Expression> callee) {
+    std::vector<NodePtr<Expression>> arguments;
 
     if(!this->check(TokenType::BRACKET_ROUND_RIGHT)) {
         do {
@@ -399,19 +443,19 @@ std::unique_ptr<Expression> Parser::finishCall(std::unique_ptr<Expression> calle
 
     Token paren = this->consume(TokenType::BRACKET_ROUND_RIGHT, "Fonksiyon çağrısı sonunda ')' bekleniyor.");
 
-    return std::make_unique<CallExpression>(std::move(callee), paren, std::move(arguments));
+    return makeNode<CallExpression>(*this->arena, std::move(callee), paren, std::move(arguments));
 }
 
-std::unique_ptr<Expression> Parser::arrayAccess(std::unique_ptr<Expression> array) {
-    std::unique_ptr<Expression> index = this->expression();
+NodePtr<Expression> Parser::arrayAccess(NodePtr<Expression> array) {
+    NodePtr<Expression> index = this->expression();
     Token bracket = this->consume(TokenType::BRACKET_SQUARE_RIGHT, "Dizi erişiminde ']' bekleniyor.");
 
-    return std::make_unique<ArrayAccessExpression>(std::move(array), std::move(index), bracket);
+    return makeNode<ArrayAccessExpression>(*this->arena, std::move(array), std::move(index), bracket);
 }
 
-std::unique_ptr<Expression> Parser::arrayExpression() {
+NodePtr<Expression> Parser::arrayExpression() {
     Token bracket = this->consume(TokenType::BRACKET_SQUARE_LEFT, "Dizi ifadesinde '[' bekleniyor.");
-    std::vector<std::unique_ptr<Expression>> elements;
+    std::vector<NodePtr<Expression>> elements;
 
     if(!this->check(TokenType::BRACKET_SQUARE_RIGHT)) {
         do {
@@ -424,28 +468,22 @@ std::unique_ptr<Expression> Parser::arrayExpression() {
 
         this->consume(TokenType::BRACKET_SQUARE_RIGHT, "Dizi ifadesinde ']' bekleniyor.");
 
-        return std::make_unique<ArrayExpression>(std::move(elements), bracket);
+        return makeNode<ArrayExpression>(*this->arena, std::move(elements), bracket);
     }
 }
 
-std::unique_ptr<Expression> Parser::primary() {
-    if(this->match(TokenType::STRING_LITERAL))
-        return std::make_unique<LiteralExpression>(this->previous());
-
-    if(this->match(TokenType::NUMBER_LITERAL))
-        return std::make_unique<LiteralExpression>(this->previous());
-
-    if(this->match({TokenType::TRUE, TokenType::FALSE}))
-        return std::make_unique<LiteralExpression>(this->previous());
+NodePtr<Expression> Parser::primary() {
+    if(this->match({TokenType::STRING_LITERAL, TokenType::NUMBER_LITERAL, TokenType::TRUE, TokenType::FALSE}))
+        return this->literal(this->previous());
 
     if(this->match(TokenType::BRACKET_SQUARE_LEFT))
         return this->arrayExpression();
 
     if(this->match(TokenType::IDENTIFIER))
-        return std::make_unique<VariableExpression>(this->previous());
+        return makeNode<VariableExpression>(*this->arena, this->previous());
 
     if (this->match(TokenType::BRACKET_ROUND_LEFT)) {
-        std::unique_ptr<Expression> expression = this->expression();
+        NodePtr<Expression> expression = this->expression();
         this->consume(TokenType::BRACKET_ROUND_RIGHT, "İfade sonunda ')' bekleniyor.");
         return expression;
     }
@@ -458,9 +496,11 @@ std::unique_ptr<Expression> Parser::primary() {
 
 
 Token Parser::advance() {
-    if(!this->isAtEnd())
-        this->currentToken++;
-    return this->previous();
+    if(!this->isAtEnd()) {
+        this->previousToken = this->currentToken;
+        this->currentToken = this->lexer.next();
+    }
+    return this->previousToken;
 }
 
 bool Parser::check(TokenType type) const {
@@ -487,19 +527,19 @@ bool Parser::match(const std::initializer_list<TokenType>& types) {
     return false;
 }
 
-Token Parser::consume(TokenType type, const std::string& message) {
+Token Parser::consume(TokenType type, const char* message) {
     if(this->check(type))
         return this->advance();
 
     this->error(this->peek(), message);
 }
 
-Token Parser::peek() const {
-    return this->tokens[this->currentToken];
+const Token& Parser::peek() const {
+    return this->currentToken;
 }
 
-Token Parser::previous() const {
-    return this->tokens[this->currentToken - 1];
+const Token& Parser::previous() const {
+    return this->previousToken;
 }
 
 bool Parser::isAtEnd() const {
@@ -529,7 +569,7 @@ void Parser::synchronize() {
     }
 }
 
-void Parser::error(const Token& token, const std::string& message) {
+void Parser::error(const Token& token, const char* message) {
     hasError = true;
 
     std::cerr << "\n\033[1;31m========== SÖZDİZİMİ HATASI ==========\033[0m" << std::endl;
@@ -537,11 +577,12 @@ void Parser::error(const Token& token, const std::string& message) {
     if (token.type == TokenType::TOKEN_EOF) {
         std::cerr << "\033[1;31mDosya sonu: " << message << "\033[0m" << std::endl;
     } else {
-        std::string tokenValue(token.start, token.length);
+        std::string tokenValue(token.lexeme());
         std::cerr << "\033[1;31mSözdizimi hatası: " << message << "\033[0m" << std::endl;
         std::cerr << "Token: '" << tokenValue << "'" << std::endl;
-        std::cerr << "Dosya: " << token.fileName << std::endl;
-        std::cerr << "Satır: " << token.line << ", Sütun: " << token.column << std::endl;
+        SourceLocation location = token.location();
+        std::cerr << "Dosya: " << SourceManager::instance().fileName(token.file) << std::endl;
+        std::cerr << "Satır: " << location.line << ", Sütun: " << location.column << std::endl;
     }
 
     std::cerr << "\033[1;31m=====================================\033[0m" << std::endl;
@@ -2,61 +2,71 @@
 #define PARSER_H
 
 #include <memory>
+#include <unordered_map>
 #include <vector>
 #include "../token/token.hpp"
+#include "../lexer/lexer.hpp"
 #include "../ast/ast.hpp"
 
+// Token'ları sözcük analizcisinden ihtiyaç duydukça çeker. Yalnızca önceki
+// ve mevcut token tutulur, bu yüzden peek/previous referansları bir sonraki
+// advance çağrısına kadar geçerlidir; saklanacak token kopyalanmalıdır.
 class Parser {
 public:
-    explicit Parser(const std::vector<Token>& tokens);
+    explicit Parser(Lexer& lexer);
 
     std::unique_ptr<Program> parse();
 
 private:
-    std::vector<Token> tokens;
-    unsigned int currentToken;
+    Lexer& lexer;
+    std::unique_ptr<Arena> arena; // Düğümler burada oluşturulur, parse() Program'a devreder
+    Token previousToken;
+    Token currentToken;
     bool hasError;
+    std::unordered_map<Symbol, Value> stringConstants; // Aynı metin sabitleri tek değeri paylaşır
 
-    std::unique_ptr<Stmt> statement();
-    std::unique_ptr<Stmt> printStatement();
-    std::unique_ptr<Stmt> expressionStatement();
-    std::unique_ptr<Stmt> blockStatement();
-    std::unique_ptr<Stmt> ifStatement();
-    std::unique_ptr<Stmt> loopStatement();
-    std::unique_ptr<Stmt> breakStatement();
-    std::unique_ptr<Stmt> continueStatement();
-    std::unique_ptr<Stmt> returnStatement();
-    std::unique_ptr<Stmt> varDeclaration();
-    std::unique_ptr<Stmt> functionDeclaration();
-
-    std::unique_ptr<Expression> expression();
-    std::unique_ptr<Expression> assignment();
-    std::unique_ptr<Expression> logicalOr();
-    std::unique_ptr<Expression> logicalAnd();
-    std::unique_ptr<Expression> equality();
-    std::unique_ptr<Expression> comparison();
-    std::unique_ptr<Expression> term();
-    std::unique_ptr<Expression> factor();
-    std::unique_ptr<Expression> power();
-    std::unique_ptr<Expression> unary();
-    std::unique_ptr<Expression> call();
-    std::unique_ptr<Expression> primary();
-    std::unique_ptr<Expression> arrayExpression();
-    std::unique_ptr<Expression> finishCall(std::unique_ptr<Expression> callee);
-    std::unique_ptr<Expression> arrayAccess(std::unique_ptr<Expression> array);
+    NodePtr<Stmt> statement();
+    NodePtr<Stmt> printStatement();
+    NodePtr<Stmt> expressionStatement();
+    NodePtr<Stmt> blockStatement();
+    NodePtr<Stmt> branchStatement();
+    NodePtr<Stmt> ifStatement();
+    NodePtr<Stmt> loopStatement();
+    NodePtr<Stmt> breakStatement();
+    NodePtr<Stmt> continueStatement();
+    NodePtr<Stmt> returnStatement();
+    NodePtr<Stmt> varDeclaration();
+    NodePtr<Stmt> functionDeclaration();
+
+    NodePtr<Expression> expression();
+    NodePtr<Expression> assignment();
+    NodePtr<Expression> logicalOr();
+    NodePtr<Expression> logicalAnd();
+    NodePtr<Expression> equality();
+    NodePtr<Expression> comparison();
+    NodePtr<Expression> term();
+    NodePtr<Expression> factor();
+    NodePtr<Expression> power();
+    NodePtr<Expression> unary();
+    NodePtr<Expression> call();
+    NodePtr<Expression> primary();
+    NodePtr<Expression> arrayExpression();
+    NodePtr<Expression> finishCall(NodePtr<Expression> callee);
+    NodePtr<Expression> arrayAccess(NodePtr<Expression> array);
+    NodePtr<Expression> literal(const Token& token);
 
     // Yardımcı metotlar
     Token advance();
     bool check(TokenType type) const;
     bool match(TokenType type);
     bool match(const std::initializer_list<TokenType>& types);
-    Token consume(TokenType type, const std::string& message);
-    Token peek() const;
-    Token previous() const;
+    Token consume(TokenType type, const char* message);
+    const Token& peek() const;
+    const Token& previous() const;
     bool isAtEnd() const;
 
     void synchronize();
-    void error(const Token& token, const std::string& message);
+    [[noreturn]] void error(const Token& token, const char* message);
 };
 
 
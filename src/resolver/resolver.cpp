@@ -0,0 +1,279 @@
+#include "resolver.hpp"
+
+#include "../builtins/builtins.hpp"
+
+void Resolver::resolve(Program* program) {
+    this->program = program;
+    this->currentFunction = nullptr;
+    this->scopes.clear();
+    this->globalIndices.clear();
+    this->globalFunctionIndices.clear();
+    program->globalSymbols.clear();
+    program->globalFunctionSymbols.clear();
+
+    program->accept(*this);
+}
+
+void Resolver::beginScope() {
+    this->scopes.emplace_back();
+}
+
+void Resolver::endScope(unsigned int& slotCount, unsigned int& functionCount) {
+    slotCount = this->scopes.back().count;
+    functionCount = this->scopes.back().functionCount;
+    this->scopes.pop_back();
+}
+
+// Aynı kapsamda yeniden tanımlanan isim aynı slotu alır,
+// hata çalışma zamanında tanım sırasında verilir
+unsigned int Resolver::declare(const Token& name) {
+    Scope& scope = this->scopes.back();
+
+    auto it = scope.slots.find(name.symbol);
+    if(it != scope.slots.end())
+        return it->second;
+
+    scope.slots[name.symbol] = scope.count;
+    return scope.count++;
+}
+
+// Aynı kapsamda yeniden tanımlanan fonksiyon öncekinin yerine geçer
+unsigned int Resolver::declareFunction(const Token& name) {
+    Scope& scope = this->scopes.back();
+
+    auto it = scope.functionSlots.find(name.symbol);
+    if(it != scope.functionSlots.end())
+        return it->second;
+
+    scope.functionSlots[name.symbol] = scope.functionCount;
+    return scope.functionCount++;
+}
+
+unsigned int Resolver::globalIndex(Symbol name) {
+    auto it = this->globalIndices.find(name);
+
+    if(it != this->globalIndices.end())
+        return it->second;
+
+    unsigned int index = this->program->globalSymbols.size();
+    this->program->globalSymbols.push_back(name);
+    this->globalIndices[name] = index;
+    return index;
+}
+
+unsigned int Resolver::globalFunctionIndex(Symbol name) {
+    auto it = this->globalFunctionIndices.find(name);
+
+    if(it != this->globalFunctionIndices.end())
+        return it->second;
+
+    unsigned int index = this->program->globalFunctionSymbols.size();
+    this->program->globalFunctionSymbols.push_back(name);
+    this->globalFunctionIndices[name] = index;
+    return index;
+}
+
+// Yerel kapsamlarda bulunamayan isimler globale geç bağlanır
+void Resolver::resolveName(const Token& name, int& depth, unsigned int& slot) {
+    for(int i = static_cast<int>(this->scopes.size()) - 1; i >= 0; i--) {
+        auto it = this->scopes[i].slots.find(name.symbol);
+
+        if(it != this->scopes[i].slots.end()) {
+            depth = static_cast<int>(this->scopes.size()) - 1 - i;
+            slot = it->second;
+            return;
+        }
+    }
+
+    depth = -1;
+    slot = this->globalIndex(name.symbol);
+}
+
+void Resolver::resolveFunction(const Token& name, int& depth, unsigned int& slot) {
+    for(int i = static_cast<int>(this->scopes.size()) - 1; i >= 0; i--) {
+        auto it = this->scopes[i].functionSlots.find(name.symbol);
+
+        if(it != this->scopes[i].functionSlots.end()) {
+            depth = static_cast<int>(this->scopes.size()) - 1 - i;
+            slot = it->second;
+            return;
+        }
+    }
+
+    depth = -1;
+    slot = this->globalFunctionIndex(name.symbol);
+}
+
+void Resolver::resolveExpression(Expression* expr) {
+    expr->accept(*this);
+}
+
+void Resolver::resolveStatement(Stmt* stmt) {
+    stmt->accept(*this);
+}
+
+void Resolver::visitBinaryExpression(BinaryExpression* expr) {
+    this->resolveExpression(expr->left.get());
+    this->resolveExpression(expr->right.get());
+}
+
+void Resolver::visitLogicalExpression(LogicalExpression* expr) {
+    this->resolveExpression(expr->left.get());
+    this->resolveExpression(expr->right.get());
+}
+
+void Resolver::visitUnaryExpression(UnaryExpression* expr) {
+    this->resolveExpression(expr->operand.get());
+}
+
+void Resolver::visitComparisonExpression(ComparisonExpression* expr) {
+    this->resolveExpression(expr->left.get());
+    this->resolveExpression(expr->right.get());
+}
+
+void Resolver::visitLiteralExpression(LiteralExpression* expr) {}
+
+void Resolver::visitVariableExpression(VariableExpression* expr) {
+    this->resolveName(expr->name, expr->depth, expr->slot);
+}
+
+void Resolver::visitAssignExpression(AssignExpression* expr) {
+    this->resolveExpression(expr->value.get());
+    this->resolveName(expr->name, expr->depth, expr->slot);
+}
+
+void Resolver::visitCallExpression(CallExpression* expr) {
+    for(auto& arg : expr->arguments)
+        this->resolveExpression(arg.get());
+
+    // İsim olmayan çağrılar bağlanmaz, hata çalışma zamanında verilir
+    auto* callee = dynamic_cast<VariableExpression*>(expr->callee.get());
+    if(callee == nullptr)
+        return;
+
+    expr->isBound = true;
+    this->resolveFunction(callee->name, expr->depth, expr->slot);
+
+    if(expr->depth == -1)
+        expr->builtin = findBuiltin(callee->name.lexeme());
+}
+
+void Resolver::visitArrayExpression(ArrayExpression* expr) {
+    for(auto& element : expr->elements)
+        this->resolveExpression(element.get());
+}
+
+void Resolver::visitArrayAccessExpression(ArrayAccessExpression* expr) {
+    this->resolveExpression(expr->array.get());
+    this->resolveExpression(expr->index.get());
+}
+
+void Resolver::visitArrayAssignExpression(ArrayAssignExpression* expr) {
+    for(auto& index : expr->indices)
+        this->resolveExpression(index.get());
+
+    this->resolveExpression(expr->value.get());
+    this->resolveName(expr->name, expr->depth, expr->slot);
+}
+
+void Resolver::visitExpressionStmt(ExpressionStmt* stmt) {
+    this->resolveExpression(stmt->expression.get());
+}
+
+void Resolver::visitPrintStmt(PrintStmt* stmt) {
+    this->resolveExpression(stmt->expression.get());
+}
+
+void Resolver::visitVarDeclStmt(VarDeclStmt* stmt) {
+    // Başlangıç değeri tanımdan önce çözülür, böylece dış kapsamdaki
+    // aynı isimli değişkeni görür
+    if(stmt->initializer != nullptr)
+        this->resolveExpression(stmt->initializer.get());
+
+    if(this->scopes.empty()) {
+        stmt->depth = -1;
+        stmt->slot = this->globalIndex(stmt->name.symbol);
+        return;
+    }
+
+    stmt->depth = 0;
+    stmt->slot = this->declare(stmt->name);
+}
+
+// Bloktaki fonksiyonlar gövdelerden önce tanımlanır, böylece birbirlerini
+// tanım sırasından bağımsız olarak çağırabilirler
+void Resolver::visitBlockStmt(BlockStmt* stmt) {
+    this->beginScope();
+    stmt->functions.clear();
+
+    for(auto& statement : stmt->statements) {
+        auto* function = dynamic_cast<FunctionDeclStmt*>(statement.get());
+        if(function == nullptr)
+            continue;
+
+        function->depth = 0;
+        function->slot = this->declareFunction(function->name);
+        function->isHoisted = true;
+        stmt->functions.push_back(function);
+    }
+
+    for(auto& statement : stmt->statements)
+        this->resolveStatement(statement.get());
+
+    this->endScope(stmt->slotCount, stmt->functionCount);
+}
+
+void Resolver::visitIfStmt(IfStmt* stmt) {
+    this->resolveExpression(stmt->condition.get());
+    this->resolveStatement(stmt->thenBranch.get());
+
+    if(stmt->elseBranch != nullptr)
+        this->resolveStatement(stmt->elseBranch.get());
+}
+
+void Resolver::visitLoopStmt(LoopStmt* stmt) {
+    this->resolveExpression(stmt->condition.get());
+    this->resolveStatement(stmt->body.get());
+}
+
+void Resolver::visitBreakStmt(BreakStmt* stmt) {}
+
+void Resolver::visitContinueStmt(ContinueStmt* stmt) {}
+
+void Resolver::visitFunctionDeclStmt(FunctionDeclStmt* stmt) {
+    // Özyinelemeli çağrılar için isim gövdeden önce tanımlanır; bloktaki
+    // fonksiyonlar visitBlockStmt'te zaten tanımlanmıştır
+    if(this->scopes.empty()) {
+        stmt->depth = -1;
+        stmt->slot = this->globalFunctionIndex(stmt->name.symbol);
+    } else if(!stmt->isHoisted) {
+        stmt->depth = 0;
+        stmt->slot = this->declareFunction(stmt->name);
+    }
+
+    FunctionDeclStmt* enclosingFunction = this->currentFunction;
+    this->currentFunction = stmt;
+
+    // Parametreler kendi kapsamında (slot 0..n-1), gövde ayrı bir blok kapsamında
+    this->beginScope();
+
+    for(const Token& param : stmt->paramNames)
+        this->declare(param);
+
+    this->resolveStatement(stmt->body.get());
+    this->scopes.pop_back();
+
+    this->currentFunction = enclosingFunction;
+}
+
+void Resolver::visitReturnStmt(ReturnStmt* stmt) {
+    stmt->function = this->currentFunction;
+
+    if(stmt->value != nullptr)
+        this->resolveExpression(stmt->value.get());
+}
+
+void Resolver::visitProgram(Program* program) {
+    for(auto& stmt : program->statements)
+        this->resolveStatement(stmt.get());
+}
@@ -0,0 +1,68 @@
+#ifndef RESOLVER_HPP
+#define RESOLVER_HPP
+
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include "../ast/ast.hpp"
+
+// Ayrıştırıcı ile yorumlayıcı arasında çalışan kapsam çözümleme geçişi.
+// Her değişken erişimi ve fonksiyon çağrısı için (derinlik, slot) hesaplanır,
+// böylece çalışma zamanında isimle arama yerine dizi indekslemesi yapılır.
+// Fonksiyonlar ayrı bir isim alanındadır. Bir bloktaki yerel fonksiyonlar
+// derleyicideki gibi bütün blokta görülür, bulunamayan isimler globale bağlanır.
+class Resolver : public ASTVisitor {
+public:
+    void resolve(Program* program);
+
+private:
+    struct Scope {
+        std::unordered_map<Symbol, unsigned int> slots;
+        std::unordered_map<Symbol, unsigned int> functionSlots;
+        unsigned int count = 0;
+        unsigned int functionCount = 0;
+    };
+
+    std::vector<Scope> scopes;
+    std::unordered_map<Symbol, unsigned int> globalIndices;
+    std::unordered_map<Symbol, unsigned int> globalFunctionIndices;
+    Program* program = nullptr;
+    FunctionDeclStmt* currentFunction = nullptr;
+
+    void beginScope();
+    void endScope(unsigned int& slotCount, unsigned int& functionCount);
+    unsigned int declare(const Token& name);
+    unsigned int declareFunction(const Token& name);
+    unsigned int globalIndex(Symbol name);
+    unsigned int globalFunctionIndex(Symbol name);
+    void resolveName(const Token& name, int& depth, unsigned int& slot);
+    void resolveFunction(const Token& name, int& depth, unsigned int& slot);
+    void resolveExpression(Expression* expr);
+    void resolveStatement(Stmt* stmt);
+
+    void visitBinaryExpression(BinaryExpression* expr) override;
+    void visitLogicalExpression(LogicalExpression* expr) override;
+    void visitUnaryExpression(UnaryExpression* expr) override;
+    void visitComparisonExpression(ComparisonExpression* expr) override;
+    void visitLiteralExpression(LiteralExpression* expr) override;
+    void visitVariableExpression(VariableExpression* expr) override;
+    void visitAssignExpression(AssignExpression* expr) override;
+    void visitCallExpression(CallExpression* expr) override;
+    void visitArrayExpression(ArrayExpression* expr) override;
+    void visitArrayAccessExpression(ArrayAccessExpression* expr) override;
+    void visitArrayAssignExpression(ArrayAssignExpression* expr) override;
+
+    void visitExpressionStmt(ExpressionStmt* stmt) override;
+    void visitPrintStmt(PrintStmt* stmt) override;
+    void visitVarDeclStmt(VarDeclStmt* stmt) override;
+    void visitBlockStmt(BlockStmt* stmt) override;
+    void visitIfStmt(IfStmt* stmt) override;
+    void visitLoopStmt(LoopStmt* stmt) override;
+    void visitBreakStmt(BreakStmt* stmt) override;
+    void visitContinueStmt(ContinueStmt* stmt) override;
+    void visitFunctionDeclStmt(FunctionDeclStmt* stmt) override;
+    void visitReturnStmt(ReturnStmt* stmt) override;
+    void visitProgram(Program* program) override;
+};
+
+#endif // RESOLVER_HPP
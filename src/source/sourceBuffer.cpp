@@ -0,0 +1,60 @@
+#include "sourceBuffer.hpp"
+
+#include <fstream>
+
+#ifndef _WIN32
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+#endif
+
+SourceBuffer::~SourceBuffer() {
+    #ifndef _WIN32
+        if(this->mapped)
+            munmap(const_cast<char*>(this->data), this->size);
+    #endif
+}
+
+bool SourceBuffer::open(const char* path) {
+    #ifndef _WIN32
+        int fd = ::open(path, O_RDONLY);
+        if(fd < 0)
+            return false;
+
+        struct stat info;
+        if(fstat(fd, &info) == 0 && S_ISREG(info.st_mode) && info.st_size > 0) {
+            void* address = mmap(nullptr, info.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+
+            if(address != MAP_FAILED) {
+                madvise(address, info.st_size, MADV_SEQUENTIAL);
+                close(fd);
+
+                this->data = static_cast<const char*>(address);
+                this->size = static_cast<size_t>(info.st_size);
+                this->mapped = true;
+                return true;
+            }
+        }
+
+        close(fd);
+    #endif
+
+    return this->readFile(path);
+}
+
+// Boş dosyalar, boru gibi özel dosyalar ve Windows için yedek yol
+bool SourceBuffer::readFile(const char* path) {
+    std::ifstream file(path, std::ios::binary);
+    if(file.fail())
+        return false;
+
+    this->contents.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+    this->data = this->contents.data();
+    this->size = this->contents.size();
+    return true;
+}
+
+std::string_view SourceBuffer::text() const {
+    return std::string_view(this->data, this->size);
+}
@@ -0,0 +1,32 @@
+#ifndef SOURCE_BUFFER_HPP
+#define SOURCE_BUFFER_HPP
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+
+// Kaynak dosyanın içeriğini kopyalamadan sunar. POSIX sistemlerde dosya
+// belleğe eşlenir (mmap), eşleme yapılamazsa veya Windows'ta dosya tek
+// seferde okunur. Token'lar bu belleği gösterdiği için nesne çalıştırma
+// boyunca yaşamalıdır.
+class SourceBuffer {
+public:
+    SourceBuffer() = default;
+    ~SourceBuffer();
+
+    SourceBuffer(const SourceBuffer&) = delete;
+    SourceBuffer& operator=(const SourceBuffer&) = delete;
+
+    bool open(const char* path);
+    std::string_view text() const;
+
+private:
+    const char* data = nullptr;
+    size_t size = 0;
+    bool mapped = false;
+    std::string contents; // Eşleme yapılamadığında okunan içerik
+
+    bool readFile(const char* path);
+};
+
+#endif // SOURCE_BUFFER_HPP
@@ -0,0 +1,47 @@
+#include "sourceManager.hpp"
+
+#include <algorithm>
+#include <stdexcept>
+
+SourceManager& SourceManager::instance() {
+    static SourceManager manager;
+    return manager;
+}
+
+FileId SourceManager::addFile(const std::string& name, std::string_view source) {
+    if(this->files.size() > UINT16_MAX)
+        throw std::runtime_error("Çok fazla kaynak dosyası açıldı.");
+
+    this->files.push_back({name, source, {}});
+    return static_cast<FileId>(this->files.size() - 1);
+}
+
+const std::string& SourceManager::fileName(FileId file) const {
+    return this->files[file].name;
+}
+
+std::string_view SourceManager::text(FileId file, uint32_t offset, uint32_t length) const {
+    return this->files[file].source.substr(offset, length);
+}
+
+SourceLocation SourceManager::location(FileId file, uint32_t offset) {
+    File& entry = this->files[file];
+
+    if(entry.lineStarts.empty()) {
+        entry.lineStarts.push_back(0);
+
+        for(size_t i = 0; i < entry.source.size(); i++)
+            if(entry.source[i] == '\n')
+                entry.lineStarts.push_back(static_cast<uint32_t>(i + 1));
+    }
+
+    auto line = std::upper_bound(entry.lineStarts.begin(), entry.lineStarts.end(), offset) - 1;
+
+    // UTF-8 devam baytları (10xxxxxx) ayrı bir karakter sayılmaz
+    unsigned int column = 1;
+    for(uint32_t i = *line; i < offset && i < entry.source.size(); i++)
+        if((static_cast<unsigned char>(entry.source[i]) & 0xC0) != 0x80)
+            column++;
+
+    return {static_cast<unsigned int>(line - entry.lineStarts.begin()) + 1, column};
+}
@@ -0,0 +1,42 @@
+#ifndef SOURCE_MANAGER_HPP
+#define SOURCE_MANAGER_HPP
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+using FileId = uint16_t;
+
+struct SourceLocation {
+    unsigned int line;
+    unsigned int column; // Satır başından itibaren karakter (kod noktası) sayısı
+};
+
+// Kaynak dosyaların adlarını ve içeriklerini tutar. Token'lar yalnızca dosya
+// kimliği ve bayt ofseti taşır; satır/sütun bilgisi tanılama gerektiğinde
+// buradan hesaplanır.
+class SourceManager {
+public:
+    static SourceManager& instance();
+
+    // İçerik kopyalanmaz, kaynak metin token'lar kullanıldığı sürece yaşamalıdır
+    FileId addFile(const std::string& name, std::string_view source);
+
+    const std::string& fileName(FileId file) const;
+    std::string_view text(FileId file, uint32_t offset, uint32_t length) const;
+    SourceLocation location(FileId file, uint32_t offset);
+
+private:
+    struct File {
+        std::string name;
+        std::string_view source;
+        std::vector<uint32_t> lineStarts; // İlk konum sorgusunda doldurulur
+    };
+
+    SourceManager() = default;
+
+    std::vector<File> files;
+};
+
+#endif // SOURCE_MANAGER_HPP
@@ -0,0 +1,111 @@
+#include "symbolTable.hpp"
+
+#include <cstring>
+
+static inline uint32_t load32(const char* data) {
+    uint32_t value;
+    std::memcpy(&value, data, 4);
+    return value;
+}
+
+static inline uint64_t load64(const char* data) {
+    uint64_t value;
+    std::memcpy(&value, data, 8);
+    return value;
+}
+
+// En fazla 8 baytlık metni kaynağın sonundan öteye okumadan tek bir sayıya
+// sığdırır. Çakışan yüklemeler bütün baytları kapsadığından aynı uzunluktaki
+// iki metin ancak eşitlerse aynı sayıyı verir.
+static inline uint64_t packShort(const char* data, unsigned int length) {
+    if(length >= 4)
+        return load32(data) | (static_cast<uint64_t>(load32(data + length - 4)) << 32);
+
+    if(length > 0) {
+        return static_cast<unsigned char>(data[0]) |
+            (static_cast<uint64_t>(static_cast<unsigned char>(data[length / 2])) << 8) |
+            (static_cast<uint64_t>(static_cast<unsigned char>(data[length - 1])) << 16);
+    }
+
+    return 0;
+}
+
+static inline uint64_t mix(uint64_t hash, uint64_t word) {
+    hash = (hash ^ word) * 0xBF58476D1CE4E5B9ull;
+    return hash ^ (hash >> 31);
+}
+
+// Kısa metinlerin özeti paketlenmiş değerden, uzunların sekizer baytlık
+// parçalardan ve çakışan son parçadan hesaplanır
+static inline uint32_t hashBytes(const char* data, unsigned int length, uint64_t packed) {
+    uint64_t hash = 0x9E3779B97F4A7C15ull ^ length;
+
+    if(length <= 8) {
+        hash = mix(hash, packed);
+    } else {
+        for(unsigned int i = 0; i + 8 < length; i += 8)
+            hash = mix(hash, load64(data + i));
+        hash = mix(hash, load64(data + length - 8));
+    }
+
+    return static_cast<uint32_t>(hash ^ (hash >> 32));
+}
+
+SymbolTable& SymbolTable::instance() {
+    static SymbolTable table;
+    return table;
+}
+
+SymbolTable::SymbolTable() {
+    this->entries.resize(1024);
+
+    // 0 numaralı sembol boş metindir, sembolü olmayan token'lar bunu taşır
+    this->intern("", 0);
+}
+
+Symbol SymbolTable::intern(const char* start, unsigned int length) {
+    uint64_t packed = length <= 8 ? packShort(start, length) : load64(start);
+    uint32_t hash = hashBytes(start, length, packed);
+    size_t mask = this->entries.size() - 1;
+
+    for(size_t i = hash & mask; ; i = (i + 1) & mask) {
+        Entry& entry = this->entries[i];
+
+        if(entry.start == nullptr) {
+            Symbol symbol = static_cast<Symbol>(this->names.size());
+            const std::string& stored = this->names.emplace_back(start, length);
+            entry = Entry{stored.data(), packed, length, hash, symbol};
+
+            if(this->names.size() * 2 > this->entries.size())
+                this->grow();
+
+            return symbol;
+        }
+
+        // 8 bayta kadar olan metinlerde paket eşitliği metin eşitliğidir
+        if(entry.hash == hash && entry.length == length && entry.packed == packed &&
+           (length <= 8 || std::memcmp(entry.start, start, length) == 0))
+            return entry.symbol;
+    }
+}
+
+void SymbolTable::grow() {
+    std::vector<Entry> old(this->entries.size() * 2);
+    old.swap(this->entries);
+    size_t mask = this->entries.size() - 1;
+
+    for(const Entry& entry : old) {
+        if(entry.start == nullptr)
+            continue;
+
+        size_t i = entry.hash & mask;
+        while(this->entries[i].start != nullptr)
+            i = (i + 1) & mask;
+
+        this->entries[i] = entry;
+    }
+}
+
+const std::string& SymbolTable::name(Symbol symbol) const {
+    return this->names[symbol];
+}
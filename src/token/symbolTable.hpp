@@ -0,0 +1,40 @@
+#ifndef SYMBOL_TABLE_HPP
+#define SYMBOL_TABLE_HPP
+
+#include <cstdint>
+#include <deque>
+#include <string>
+#include <string_view>
+#include <vector>
+
+// Tanımlayıcı ve metin sabitleri için küresel tekilleştirme tablosu.
+// Aynı metin her zaman aynı kimliği alır, karşılaştırmalar kimlikle yapılır.
+using Symbol = uint32_t;
+
+class SymbolTable {
+public:
+    static SymbolTable& instance();
+
+    Symbol intern(const char* start, unsigned int length);
+    const std::string& name(Symbol symbol) const;
+
+private:
+    // Açık adresli tablo girişi. Özet bir kez hesaplanır ve saklanır;
+    // 8 bayta kadar olan metinler paketlenmiş değerleriyle karşılaştırılır.
+    struct Entry {
+        const char* start = nullptr; // Boş girişlerde nullptr
+        uint64_t packed = 0;
+        uint32_t length = 0;
+        uint32_t hash = 0;
+        Symbol symbol = 0;
+    };
+
+    SymbolTable();
+
+    void grow();
+
+    std::deque<std::string> names; // deque, eklemede mevcut elemanları taşımaz
+    std::vector<Entry> entries;     // Boyutu ikinin kuvveti, en fazla yarısı dolu
+};
+
+#endif // SYMBOL_TABLE_HPP
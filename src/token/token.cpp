@@ -1,7 +1,18 @@
 #include "token.hpp"
 
 Token::Token()
-    : type(TokenType::TOKEN_EOF), fileName(""), start(nullptr), length(0), line(0), column(0) {}
+    : type(TokenType::TOKEN_EOF), file(0), offset(0), length(0), symbol(0) {}
 
-Token::Token(TokenType type, const std::string& fileName, const char* start, unsigned int length, unsigned int line, unsigned int column)
-    : type(type), fileName(fileName),start(start), length(length), line(line), column(column) {}
+Token::Token(TokenType type, FileId file, uint32_t offset, uint32_t length, Symbol symbol)
+    : type(type), file(file), offset(offset), length(length), symbol(symbol) {}
+
+std::string_view Token::lexeme() const {
+    if(this->type == TokenType::TOKEN_ERROR)
+        return SymbolTable::instance().name(this->symbol);
+
+    return SourceManager::instance().text(this->file, this->offset, this->length);
+}
+
+SourceLocation Token::location() const {
+    return SourceManager::instance().location(this->file, this->offset);
+}
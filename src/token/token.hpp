@@ -1,9 +1,12 @@
 #ifndef TOKEN_HPP
 #define TOKEN_HPP
 
-#include <string>
+#include <cstdint>
+#include <string_view>
+#include "symbolTable.hpp"
+#include "../source/sourceManager.hpp"
 
-enum class TokenType {
+enum class TokenType : uint8_t {
     TOKEN_EOF,
     TOKEN_ERROR,
 
@@ -73,18 +76,24 @@ enum class TokenType {
     PRINT                         // yaz
 };
 
+// Kaynakta bir aralığı gösteren 16 baytlık token. Metin ve konum bilgisi
+// SourceManager üzerinden dosya kimliği ve ofset ile bulunur.
 class Token {
 public:
     TokenType type;
-    std::string fileName;
-    const char* start;
-    unsigned int length;
-    unsigned int line;
-    unsigned int column;
+    FileId file;
+    uint32_t offset;
+    uint32_t length;
+    Symbol symbol; // Tanımlayıcı ve metin sabitlerinin tekil kimliği, hata token'larında mesaj
 
     Token();
 
-    Token(TokenType type, const std::string& fileName, const char* start, unsigned int length, unsigned int line, unsigned int column);
+    Token(TokenType type, FileId file, uint32_t offset, uint32_t length, Symbol symbol = 0);
+
+    std::string_view lexeme() const;
+    SourceLocation location() const;
 };
 
+static_assert(sizeof(Token) <= 16, "Token 16 baytı geçmemeli");
+
 #endif // TOKEN_HPP
\ No newline at end of file
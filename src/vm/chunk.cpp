@@ -0,0 +1,20 @@
+#include "chunk.hpp"
+
+#include <stdexcept>
+
+void Chunk::writeOp(OpCode op) {
+    this->code.push_back(static_cast<uint8_t>(op));
+}
+
+void Chunk::writeShort(uint16_t value) {
+    this->code.push_back(static_cast<uint8_t>(value >> 8));
+    this->code.push_back(static_cast<uint8_t>(value & 0xff));
+}
+
+uint16_t Chunk::addConstant(const Value& value) {
+    if(this->constants.size() > UINT16_MAX)
+        throw std::runtime_error("Bir fonksiyonda çok fazla sabit değer var.");
+
+    this->constants.push_back(value);
+    return static_cast<uint16_t>(this->constants.size() - 1);
+}
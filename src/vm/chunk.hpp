@@ -0,0 +1,105 @@
+#ifndef CHUNK_HPP
+#define CHUNK_HPP
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+#include "../interpreter/value.hpp"
+#include "../token/symbolTable.hpp"
+
+struct Builtin;
+
+// Operand genişlikleri yorumda belirtilmiştir, tüm operandlar 16 bittir.
+// SET_INDEX_* komutlarında işlem 0 ise düz atama, değilse bileşik atamada
+// uygulanan ADD/SUBTRACT/MULTIPLY/DIVIDE komutudur.
+enum class OpCode : uint8_t {
+    CONSTANT,                     // [sabit]
+    NIL,
+    TRUE,
+    FALSE,
+    POP,
+    POP_N,                        // [adet]
+
+    GET_LOCAL,                    // [slot]
+    SET_LOCAL,                    // [slot, isim sabiti]
+    GET_OUTER,                    // [atlama, slot]
+    SET_OUTER,                    // [atlama, slot, isim sabiti]
+    GET_GLOBAL,                   // [global]
+    SET_GLOBAL,                   // [global]
+    DEFINE_GLOBAL,                // [global, sabit mi]
+    DEFINE_FUNCTION,              // [global fonksiyon, fonksiyon]
+    CHECK_TYPE,                   // [tip]
+    CHECK_RETURN,                 // [tip]
+
+    ADD,
+    SUBTRACT,
+    MULTIPLY,
+    DIVIDE,
+    MODULUS,
+    POWER,
+    NEGATE,
+    NOT,
+
+    EQUAL,
+    NOT_EQUAL,
+    GREAT,
+    GREAT_EQUAL,
+    LESS,
+    LESS_EQUAL,
+
+    JUMP,                         // [ileri atlama]
+    JUMP_IF_FALSE,                // [ileri atlama], koşulu yığından çıkarır
+    JUMP_IF_FALSE_OR_POP,         // [ileri atlama], && için
+    JUMP_IF_TRUE_OR_POP,          // [ileri atlama], || için
+    LOOP,                         // [geri atlama]
+
+    CALL,                         // [fonksiyon, argüman sayısı]
+    CALL_GLOBAL,                  // [global fonksiyon, argüman sayısı]
+    RETURN,
+
+    ARRAY,                        // [eleman sayısı]
+    INDEX,
+    SET_INDEX_LOCAL,              // [slot, indeks sayısı, işlem, isim sabiti]
+    SET_INDEX_OUTER,              // [atlama, slot, indeks sayısı, işlem, isim sabiti]
+    SET_INDEX_GLOBAL,             // [global, indeks sayısı, işlem]
+    PRINT,
+    ERROR                         // [mesaj sabiti]
+};
+
+// Derleme zamanında bilinen değişken/parametre tipleri
+enum class TypeTag : uint8_t {
+    NUMBER,
+    STRING,
+    BOOL,
+    ARRAY
+};
+
+class Chunk {
+public:
+    std::vector<uint8_t> code;
+    std::vector<Value> constants;
+
+    void writeOp(OpCode op);
+    void writeShort(uint16_t value);
+    uint16_t addConstant(const Value& value);
+};
+
+struct FunctionProto {
+    std::string name;
+    std::vector<TypeTag> paramTypes;
+    bool hasReturnType = false;
+    TypeTag returnType = TypeTag::NUMBER;
+    unsigned int depth = 0; // İç içe fonksiyon derinliği, ana program için 0
+    Chunk chunk;
+};
+
+// Derlenmiş program: functions[0] ana programdır
+struct Module {
+    std::vector<std::unique_ptr<FunctionProto>> functions;
+    std::vector<Symbol> globalNames;
+    std::vector<Symbol> globalFunctionNames;
+    std::vector<const Builtin*> globalBuiltins; // Global fonksiyon tanımsızsa çağrılan yerleşik fonksiyon
+};
+
+#endif // CHUNK_HPP
@@ -0,0 +1,634 @@
+#include "compiler.hpp"
+
+#include <stdexcept>
+#include "../builtins/builtins.hpp"
+
+std::unique_ptr<Module> Compiler::compile(Program* program) {
+    this->module = std::make_unique<Module>();
+    this->globalIndices.clear();
+    this->globalFunctionIndices.clear();
+
+    this->module->functions.push_back(std::make_unique<FunctionProto>());
+    FunctionProto* script = this->module->functions.back().get();
+    script->name = "<program>";
+
+    FunctionState state{script, nullptr, {}, {}, {}, 0};
+    this->current = &state;
+
+    program->accept(*this);
+
+    this->emitOp(OpCode::NIL);
+    this->emitOp(OpCode::RETURN);
+
+    this->current = nullptr;
+    return std::move(this->module);
+}
+
+Chunk& Compiler::chunk() {
+    return this->current->proto->chunk;
+}
+
+void Compiler::emitOp(OpCode op) {
+    this->chunk().writeOp(op);
+}
+
+void Compiler::emitOp(OpCode op, uint16_t operand) {
+    this->chunk().writeOp(op);
+    this->chunk().writeShort(operand);
+}
+
+void Compiler::emitShort(uint16_t value) {
+    this->chunk().writeShort(value);
+}
+
+void Compiler::emitConstant(const Value& value) {
+    this->emitOp(OpCode::CONSTANT, this->chunk().addConstant(value));
+}
+
+void Compiler::emitError(const std::string& message) {
+    this->emitOp(OpCode::ERROR, this->chunk().addConstant(Value(message)));
+}
+
+size_t Compiler::emitJump(OpCode op) {
+    this->emitOp(op, 0xffff);
+    return this->chunk().code.size() - 2;
+}
+
+void Compiler::patchJump(size_t offset) {
+    size_t jump = this->chunk().code.size() - offset - 2;
+
+    if(jump > UINT16_MAX)
+        throw std::runtime_error("Atlanacak kod bloğu çok büyük.");
+
+    this->chunk().code[offset] = static_cast<uint8_t>(jump >> 8);
+    this->chunk().code[offset + 1] = static_cast<uint8_t>(jump & 0xff);
+}
+
+void Compiler::emitLoop(size_t start) {
+    size_t jump = this->chunk().code.size() - start + 3;
+
+    if(jump > UINT16_MAX)
+        throw std::runtime_error("Döngü gövdesi çok büyük.");
+
+    this->emitOp(OpCode::LOOP, static_cast<uint16_t>(jump));
+}
+
+// depth'ten daha derin kapsamlardaki yerel değişkenleri yığından çıkarır,
+// derleyicinin kapsam bilgisine dokunmaz (dur/devam için)
+void Compiler::emitPopLocals(int depth) {
+    uint16_t count = 0;
+
+    for(auto it = this->current->locals.rbegin(); it != this->current->locals.rend() && it->depth > depth; ++it)
+        count++;
+
+    if(count == 1)
+        this->emitOp(OpCode::POP);
+    else if(count > 1)
+        this->emitOp(OpCode::POP_N, count);
+}
+
+void Compiler::beginScope() {
+    this->current->scopeDepth++;
+}
+
+void Compiler::endScope() {
+    this->current->scopeDepth--;
+    this->emitPopLocals(this->current->scopeDepth);
+
+    std::vector<Local>& locals = this->current->locals;
+    while(!locals.empty() && locals.back().depth > this->current->scopeDepth)
+        locals.pop_back();
+
+    std::vector<LocalFunction>& functions = this->current->functions;
+    while(!functions.empty() && functions.back().depth > this->current->scopeDepth)
+        functions.pop_back();
+}
+
+void Compiler::compileExpression(Expression* expr) {
+    expr->accept(*this);
+}
+
+void Compiler::compileStatement(Stmt* stmt) {
+    stmt->accept(*this);
+}
+
+uint16_t Compiler::globalIndex(Symbol name) {
+    auto it = this->globalIndices.find(name);
+
+    if(it != this->globalIndices.end())
+        return it->second;
+
+    if(this->module->globalNames.size() > UINT16_MAX)
+        throw std::runtime_error("Çok fazla global değişken var.");
+
+    uint16_t index = static_cast<uint16_t>(this->module->globalNames.size());
+    this->module->globalNames.push_back(name);
+    this->globalIndices[name] = index;
+    return index;
+}
+
+uint16_t Compiler::globalFunctionIndex(Symbol name) {
+    auto it = this->globalFunctionIndices.find(name);
+
+    if(it != this->globalFunctionIndices.end())
+        return it->second;
+
+    if(this->module->globalFunctionNames.size() > UINT16_MAX)
+        throw std::runtime_error("Çok fazla global fonksiyon var.");
+
+    uint16_t index = static_cast<uint16_t>(this->module->globalFunctionNames.size());
+    this->module->globalFunctionNames.push_back(name);
+    this->module->globalBuiltins.push_back(findBuiltin(SymbolTable::instance().name(name)));
+    this->globalFunctionIndices[name] = index;
+    return index;
+}
+
+int Compiler::resolveLocal(FunctionState* state, Symbol name) {
+    for(int i = static_cast<int>(state->locals.size()) - 1; i >= 0; i--) {
+        if(state->locals[i].name == name)
+            return i;
+    }
+
+    return -1;
+}
+
+TypeTag Compiler::typeTag(const Token& type) const {
+    switch(type.type) {
+    case TokenType::TYPE_STRING:
+        return TypeTag::STRING;
+    case TokenType::TYPE_BOOL:
+        return TypeTag::BOOL;
+    default:
+        return TypeTag::NUMBER;
+    }
+}
+
+TypeTag Compiler::typeTag(ValueType type) const {
+    switch(type) {
+    case ValueType::STRING:
+        return TypeTag::STRING;
+    case ValueType::BOOL:
+        return TypeTag::BOOL;
+    case ValueType::ARRAY:
+        return TypeTag::ARRAY;
+    default:
+        return TypeTag::NUMBER;
+    }
+}
+
+OpCode Compiler::binaryOp(Operator operation) const {
+    switch(operation) {
+    case Operator::ADD:
+        return OpCode::ADD;
+    case Operator::SUBTRACT:
+        return OpCode::SUBTRACT;
+    case Operator::MULTIPLY:
+        return OpCode::MULTIPLY;
+    case Operator::DIVIDE:
+        return OpCode::DIVIDE;
+    case Operator::MODULUS:
+        return OpCode::MODULUS;
+    case Operator::POWER:
+        return OpCode::POWER;
+    default:
+        throw std::runtime_error("Bilinmeyen ikili işlem.");
+    }
+}
+
+void Compiler::visitBinaryExpression(BinaryExpression* expr) {
+    this->compileExpression(expr->left.get());
+    this->compileExpression(expr->right.get());
+
+    this->emitOp(this->binaryOp(expr->operation));
+}
+
+void Compiler::visitLogicalExpression(LogicalExpression* expr) {
+    this->compileExpression(expr->left.get());
+
+    OpCode op = expr->operation == Operator::AND ? OpCode::JUMP_IF_FALSE_OR_POP : OpCode::JUMP_IF_TRUE_OR_POP;
+    size_t endJump = this->emitJump(op);
+
+    this->compileExpression(expr->right.get());
+    this->patchJump(endJump);
+}
+
+void Compiler::visitUnaryExpression(UnaryExpression* expr) {
+    this->compileExpression(expr->operand.get());
+
+    if(expr->operation == Operator::NEGATE)
+        this->emitOp(OpCode::NEGATE);
+    else
+        this->emitOp(OpCode::NOT);
+}
+
+void Compiler::visitComparisonExpression(ComparisonExpression* expr) {
+    this->compileExpression(expr->left.get());
+    this->compileExpression(expr->right.get());
+
+    switch(expr->operation) {
+    case Operator::GREAT:
+        this->emitOp(OpCode::GREAT);
+        break;
+    case Operator::GREAT_EQUAL:
+        this->emitOp(OpCode::GREAT_EQUAL);
+        break;
+    case Operator::LESS:
+        this->emitOp(OpCode::LESS);
+        break;
+    case Operator::LESS_EQUAL:
+        this->emitOp(OpCode::LESS_EQUAL);
+        break;
+    case Operator::EQUAL:
+        this->emitOp(OpCode::EQUAL);
+        break;
+    case Operator::NOT_EQUAL:
+        this->emitOp(OpCode::NOT_EQUAL);
+        break;
+    default:
+        throw std::runtime_error("Bilinmeyen karşılaştırma işlemi.");
+    }
+}
+
+void Compiler::visitLiteralExpression(LiteralExpression* expr) {
+    switch(expr->token.type) {
+    case TokenType::NUMBER_LITERAL:
+    case TokenType::STRING_LITERAL:
+        this->emitConstant(expr->value);
+        break;
+    case TokenType::TRUE:
+        this->emitOp(OpCode::TRUE);
+        break;
+    case TokenType::FALSE:
+        this->emitOp(OpCode::FALSE);
+        break;
+    default:
+        this->emitOp(OpCode::NIL);
+    }
+}
+
+void Compiler::visitVariableExpression(VariableExpression* expr) {
+    Symbol name = expr->name.symbol;
+
+    int slot = this->resolveLocal(this->current, name);
+    if(slot != -1) {
+        this->emitOp(OpCode::GET_LOCAL, static_cast<uint16_t>(slot));
+        return;
+    }
+
+    uint16_t hops = 1;
+    for(FunctionState* state = this->current->enclosing; state != nullptr; state = state->enclosing, hops++) {
+        slot = this->resolveLocal(state, name);
+        if(slot != -1) {
+            this->emitOp(OpCode::GET_OUTER, hops);
+            this->emitShort(static_cast<uint16_t>(slot));
+            return;
+        }
+    }
+
+    this->emitOp(OpCode::GET_GLOBAL, this->globalIndex(name));
+}
+
+void Compiler::visitAssignExpression(AssignExpression* expr) {
+    this->compileExpression(expr->value.get());
+
+    Symbol name = expr->name.symbol;
+    const std::string& text = SymbolTable::instance().name(name);
+
+    int slot = this->resolveLocal(this->current, name);
+    if(slot != -1) {
+        if(this->current->locals[slot].isConst) {
+            this->emitError("Sabit bir değişkene değer atanamaz: " + text);
+            return;
+        }
+
+        this->emitOp(OpCode::SET_LOCAL, static_cast<uint16_t>(slot));
+        this->emitShort(this->chunk().addConstant(Value(text)));
+        return;
+    }
+
+    uint16_t hops = 1;
+    for(FunctionState* state = this->current->enclosing; state != nullptr; state = state->enclosing, hops++) {
+        slot = this->resolveLocal(state, name);
+        if(slot != -1) {
+            if(state->locals[slot].isConst) {
+                this->emitError("Sabit bir değişkene değer atanamaz: " + text);
+                return;
+            }
+
+            this->emitOp(OpCode::SET_OUTER, hops);
+            this->emitShort(static_cast<uint16_t>(slot));
+            this->emitShort(this->chunk().addConstant(Value(text)));
+            return;
+        }
+    }
+
+    this->emitOp(OpCode::SET_GLOBAL, this->globalIndex(name));
+}
+
+void Compiler::visitCallExpression(CallExpression* expr) {
+    VariableExpression* varExpr = dynamic_cast<VariableExpression*>(expr->callee.get());
+    if(!varExpr) {
+        this->emitError("Fonksiyon çağrısı geçersiz.");
+        return;
+    }
+
+    if(expr->arguments.size() > UINT16_MAX)
+        throw std::runtime_error("Fonksiyon çağrısında çok fazla argüman var.");
+
+    for(auto& arg : expr->arguments)
+        this->compileExpression(arg.get());
+
+    uint16_t argCount = static_cast<uint16_t>(expr->arguments.size());
+    Symbol name = varExpr->name.symbol;
+
+    for(FunctionState* state = this->current; state != nullptr; state = state->enclosing) {
+        for(auto it = state->functions.rbegin(); it != state->functions.rend(); ++it) {
+            if(it->name == name) {
+                this->emitOp(OpCode::CALL, it->index);
+                this->emitShort(argCount);
+                return;
+            }
+        }
+    }
+
+    this->emitOp(OpCode::CALL_GLOBAL, this->globalFunctionIndex(name));
+    this->emitShort(argCount);
+}
+
+void Compiler::visitArrayExpression(ArrayExpression* expr) {
+    if(expr->elements.size() > UINT16_MAX)
+        throw std::runtime_error("Dizi ifadesinde çok fazla eleman var.");
+
+    for(auto& element : expr->elements)
+        this->compileExpression(element.get());
+
+    this->emitOp(OpCode::ARRAY, static_cast<uint16_t>(expr->elements.size()));
+}
+
+void Compiler::visitArrayAccessExpression(ArrayAccessExpression* expr) {
+    this->compileExpression(expr->array.get());
+    this->compileExpression(expr->index.get());
+    this->emitOp(OpCode::INDEX);
+}
+
+// İndeksler ve değer yığına konur, eleman kök değişkenin slotu üzerinden yerinde değiştirilir
+void Compiler::visitArrayAssignExpression(ArrayAssignExpression* expr) {
+    if(expr->indices.size() > UINT16_MAX)
+        throw std::runtime_error("Dizi atamasında çok fazla indeks var.");
+
+    for(auto& index : expr->indices)
+        this->compileExpression(index.get());
+
+    this->compileExpression(expr->value.get());
+
+    uint16_t count = static_cast<uint16_t>(expr->indices.size());
+    uint16_t operation = expr->isCompound ? static_cast<uint16_t>(this->binaryOp(expr->operation)) : 0;
+
+    Symbol name = expr->name.symbol;
+    const std::string& text = SymbolTable::instance().name(name);
+
+    int slot = this->resolveLocal(this->current, name);
+    if(slot != -1) {
+        if(this->current->locals[slot].isConst) {
+            this->emitError("Sabit bir değişkene değer atanamaz: " + text);
+            return;
+        }
+
+        this->emitOp(OpCode::SET_INDEX_LOCAL, static_cast<uint16_t>(slot));
+        this->emitShort(count);
+        this->emitShort(operation);
+        this->emitShort(this->chunk().addConstant(Value(text)));
+        return;
+    }
+
+    uint16_t hops = 1;
+    for(FunctionState* state = this->current->enclosing; state != nullptr; state = state->enclosing, hops++) {
+        slot = this->resolveLocal(state, name);
+        if(slot != -1) {
+            if(state->locals[slot].isConst) {
+                this->emitError("Sabit bir değişkene değer atanamaz: " + text);
+                return;
+            }
+
+            this->emitOp(OpCode::SET_INDEX_OUTER, hops);
+            this->emitShort(static_cast<uint16_t>(slot));
+            this->emitShort(count);
+            this->emitShort(operation);
+            this->emitShort(this->chunk().addConstant(Value(text)));
+            return;
+        }
+    }
+
+    this->emitOp(OpCode::SET_INDEX_GLOBAL, this->globalIndex(name));
+    this->emitShort(count);
+    this->emitShort(operation);
+}
+
+void Compiler::visitExpressionStmt(ExpressionStmt* stmt) {
+    this->compileExpression(stmt->expression.get());
+    this->emitOp(OpCode::POP);
+}
+
+void Compiler::visitPrintStmt(PrintStmt* stmt) {
+    this->compileExpression(stmt->expression.get());
+    this->emitOp(OpCode::PRINT);
+}
+
+void Compiler::visitVarDeclStmt(VarDeclStmt* stmt) {
+    if(stmt->initializer != nullptr) {
+        this->compileExpression(stmt->initializer.get());
+        this->emitOp(OpCode::CHECK_TYPE, static_cast<uint16_t>(this->typeTag(stmt->valueType)));
+    } else {
+        this->emitOp(OpCode::NIL);
+    }
+
+    Symbol name = stmt->name.symbol;
+
+    if(this->current->scopeDepth == 0 && this->current->enclosing == nullptr) {
+        this->emitOp(OpCode::DEFINE_GLOBAL, this->globalIndex(name));
+        this->emitShort(stmt->isConst ? 1 : 0);
+        return;
+    }
+
+    for(auto it = this->current->locals.rbegin(); it != this->current->locals.rend() && it->depth == this->current->scopeDepth; ++it) {
+        if(it->name == name) {
+            this->emitError("Bu isimde bir değişken zaten tanımlı: " + SymbolTable::instance().name(name));
+            return;
+        }
+    }
+
+    if(this->current->locals.size() > UINT16_MAX)
+        throw std::runtime_error("Bir fonksiyonda çok fazla yerel değişken var.");
+
+    this->current->locals.push_back({name, this->current->scopeDepth, stmt->isConst});
+}
+
+// Bloktaki fonksiyonlar gövdelerden önce kaydedilir, böylece birbirlerini
+// tanım sırasından bağımsız olarak çağırabilirler
+void Compiler::visitBlockStmt(BlockStmt* stmt) {
+    this->beginScope();
+
+    for(auto& statement : stmt->statements) {
+        auto* function = dynamic_cast<FunctionDeclStmt*>(statement.get());
+
+        if(function != nullptr)
+            this->current->functions.push_back({function->name.symbol, this->current->scopeDepth, this->addFunction(), function});
+    }
+
+    for(auto& statement : stmt->statements)
+        this->compileStatement(statement.get());
+
+    this->endScope();
+}
+
+void Compiler::visitIfStmt(IfStmt* stmt) {
+    this->compileExpression(stmt->condition.get());
+
+    size_t elseJump = this->emitJump(OpCode::JUMP_IF_FALSE);
+    this->compileStatement(stmt->thenBranch.get());
+
+    if(stmt->elseBranch == nullptr) {
+        this->patchJump(elseJump);
+        return;
+    }
+
+    size_t endJump = this->emitJump(OpCode::JUMP);
+    this->patchJump(elseJump);
+    this->compileStatement(stmt->elseBranch.get());
+    this->patchJump(endJump);
+}
+
+void Compiler::visitLoopStmt(LoopStmt* stmt) {
+    size_t start = this->chunk().code.size();
+    this->compileExpression(stmt->condition.get());
+
+    size_t exitJump = this->emitJump(OpCode::JUMP_IF_FALSE);
+
+    this->current->loops.push_back({start, this->current->scopeDepth, {}});
+    this->compileStatement(stmt->body.get());
+    this->emitLoop(start);
+
+    this->patchJump(exitJump);
+    for(size_t breakJump : this->current->loops.back().breakJumps)
+        this->patchJump(breakJump);
+
+    this->current->loops.pop_back();
+}
+
+void Compiler::visitBreakStmt(BreakStmt* stmt) {
+    if(this->current->loops.empty()) {
+        this->emitError("'dur' yalnızca döngü içinde kullanılabilir.");
+        return;
+    }
+
+    Loop& loop = this->current->loops.back();
+    this->emitPopLocals(loop.scopeDepth);
+    loop.breakJumps.push_back(this->emitJump(OpCode::JUMP));
+}
+
+void Compiler::visitContinueStmt(ContinueStmt* stmt) {
+    if(this->current->loops.empty()) {
+        this->emitError("'devam' yalnızca döngü içinde kullanılabilir.");
+        return;
+    }
+
+    Loop& loop = this->current->loops.back();
+    this->emitPopLocals(loop.scopeDepth);
+    this->emitLoop(loop.start);
+}
+
+uint16_t Compiler::addFunction() {
+    if(this->module->functions.size() > UINT16_MAX)
+        throw std::runtime_error("Çok fazla fonksiyon tanımı var.");
+
+    this->module->functions.push_back(std::make_unique<FunctionProto>());
+    return static_cast<uint16_t>(this->module->functions.size() - 1);
+}
+
+void Compiler::visitFunctionDeclStmt(FunctionDeclStmt* stmt) {
+    Symbol name = stmt->name.symbol;
+    bool isGlobal = this->current->scopeDepth == 0 && this->current->enclosing == nullptr;
+
+    // Bloktaki fonksiyonlar visitBlockStmt'te kaydedilmiştir; blok dışındaki
+    // tanımlar özyinelemeli çağrılar için gövdeden önce kaydedilir
+    const LocalFunction* hoisted = nullptr;
+    for(auto it = this->current->functions.rbegin(); it != this->current->functions.rend(); ++it) {
+        if(it->declaration == stmt) {
+            hoisted = &*it;
+            break;
+        }
+    }
+
+    uint16_t index = hoisted != nullptr ? hoisted->index : this->addFunction();
+    FunctionProto* proto = this->module->functions[index].get();
+
+    if(!isGlobal && hoisted == nullptr)
+        this->current->functions.push_back({name, this->current->scopeDepth, index, stmt});
+
+    this->compileFunction(stmt, proto);
+
+    if(isGlobal) {
+        this->emitOp(OpCode::DEFINE_FUNCTION, this->globalFunctionIndex(name));
+        this->emitShort(index);
+    }
+}
+
+void Compiler::compileFunction(FunctionDeclStmt* stmt, FunctionProto* proto) {
+    proto->name = SymbolTable::instance().name(stmt->name.symbol);
+    proto->depth = this->current->proto->depth + 1;
+    proto->hasReturnType = stmt->returnType.type != TokenType::TOKEN_EOF;
+    if(proto->hasReturnType)
+        proto->returnType = this->typeTag(stmt->returnType);
+
+    FunctionState state{proto, this->current, {}, {}, {}, 1};
+
+    // Parametreler kendi kapsamında, gövde ise ayrı bir blok kapsamında
+    for(size_t i = 0; i < stmt->paramNames.size(); i++) {
+        proto->paramTypes.push_back(this->typeTag(stmt->paramValueTypes[i]));
+        state.locals.push_back({stmt->paramNames[i].symbol, 1, false});
+    }
+
+    this->current = &state;
+
+    this->compileStatement(stmt->body.get());
+    this->emitOp(OpCode::NIL);
+    this->emitOp(OpCode::RETURN);
+
+    this->current = state.enclosing;
+}
+
+void Compiler::visitReturnStmt(ReturnStmt* stmt) {
+    if(this->current->enclosing == nullptr) {
+        this->emitError("'dön' yalnızca fonksiyon içinde kullanılabilir.");
+        return;
+    }
+
+    FunctionProto* proto = this->current->proto;
+
+    if(!proto->hasReturnType) {
+        if(stmt->value != nullptr) {
+            this->emitError("Bu fonksiyon değer döndürmemeli.");
+            return;
+        }
+
+        this->emitOp(OpCode::NIL);
+        this->emitOp(OpCode::RETURN);
+        return;
+    }
+
+    if(stmt->value == nullptr) {
+        std::string typeName = proto->returnType == TypeTag::STRING ? "metin" :
+            proto->returnType == TypeTag::BOOL ? "doğruluk" : "sayı";
+        this->emitError("Fonksiyon " + typeName + " tipinde değer döndürmeli.");
+        return;
+    }
+
+    this->compileExpression(stmt->value.get());
+    this->emitOp(OpCode::CHECK_RETURN, static_cast<uint16_t>(proto->returnType));
+    this->emitOp(OpCode::RETURN);
+}
+
+void Compiler::visitProgram(Program* program) {
+    for(auto& stmt : program->statements)
+        this->compileStatement(stmt.get());
+}
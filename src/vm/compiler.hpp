@@ -0,0 +1,102 @@
+#ifndef COMPILER_HPP
+#define COMPILER_HPP
+
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include "../ast/ast.hpp"
+#include "chunk.hpp"
+
+// AST'yi yığın tabanlı sanal makine için bayt koduna çevirir.
+// Yerel değişkenler ve fonksiyonlar derleme zamanında çözülür,
+// global değişken ve fonksiyonlar ise indeksle geç bağlanır.
+class Compiler : public ASTVisitor {
+public:
+    std::unique_ptr<Module> compile(Program* program);
+
+private:
+    struct Local {
+        Symbol name;
+        int depth;
+        bool isConst;
+    };
+
+    struct LocalFunction {
+        Symbol name;
+        int depth;
+        uint16_t index;
+        FunctionDeclStmt* declaration;
+    };
+
+    struct Loop {
+        size_t start;
+        int scopeDepth;
+        std::vector<size_t> breakJumps;
+    };
+
+    struct FunctionState {
+        FunctionProto* proto;
+        FunctionState* enclosing;
+        std::vector<Local> locals;
+        std::vector<LocalFunction> functions;
+        std::vector<Loop> loops;
+        int scopeDepth;
+    };
+
+    std::unique_ptr<Module> module;
+    FunctionState* current = nullptr;
+    std::unordered_map<Symbol, uint16_t> globalIndices;
+    std::unordered_map<Symbol, uint16_t> globalFunctionIndices;
+
+    Chunk& chunk();
+    void emitOp(OpCode op);
+    void emitOp(OpCode op, uint16_t operand);
+    void emitShort(uint16_t value);
+    void emitConstant(const Value& value);
+    void emitError(const std::string& message);
+    size_t emitJump(OpCode op);
+    void patchJump(size_t offset);
+    void emitLoop(size_t start);
+    void emitPopLocals(int depth);
+
+    void beginScope();
+    void endScope();
+    void compileExpression(Expression* expr);
+    void compileStatement(Stmt* stmt);
+    void compileFunction(FunctionDeclStmt* stmt, FunctionProto* proto);
+    uint16_t addFunction();
+
+    uint16_t globalIndex(Symbol name);
+    uint16_t globalFunctionIndex(Symbol name);
+    int resolveLocal(FunctionState* state, Symbol name);
+    TypeTag typeTag(const Token& type) const;
+    TypeTag typeTag(ValueType type) const;
+    OpCode binaryOp(Operator operation) const;
+
+    void visitBinaryExpression(BinaryExpression* expr) override;
+    void visitLogicalExpression(LogicalExpression* expr) override;
+    void visitUnaryExpression(UnaryExpression* expr) override;
+    void visitComparisonExpression(ComparisonExpression* expr) override;
+    void visitLiteralExpression(LiteralExpression* expr) override;
+    void visitVariableExpression(VariableExpression* expr) override;
+    void visitAssignExpression(AssignExpression* expr) override;
+    void visitCallExpression(CallExpression* expr) override;
+    void visitArrayExpression(ArrayExpression* expr) override;
+    void visitArrayAccessExpression(ArrayAccessExpression* expr) override;
+    void visitArrayAssignExpression(ArrayAssignExpression* expr) override;
+
+    void visitExpressionStmt(ExpressionStmt* stmt) override;
+    void visitPrintStmt(PrintStmt* stmt) override;
+    void visitVarDeclStmt(VarDeclStmt* stmt) override;
+    void visitBlockStmt(BlockStmt* stmt) override;
+    void visitIfStmt(IfStmt* stmt) override;
+    void visitLoopStmt(LoopStmt* stmt) override;
+    void visitBreakStmt(BreakStmt* stmt) override;
+    void visitContinueStmt(ContinueStmt* stmt) override;
+    void visitFunctionDeclStmt(FunctionDeclStmt* stmt) override;
+    void visitReturnStmt(ReturnStmt* stmt) override;
+    void visitProgram(Program* program) override;
+};
+
+#endif // COMPILER_HPP
@@ -0,0 +1,580 @@
+#include "vm.hpp"
+
+#include <cmath>
+#include <iostream>
+#include <stdexcept>
+#include "compiler.hpp"
+#include "../builtins/builtins.hpp"
+#include "../output/outputBuffer.hpp"
+
+VM::VM() {
+    this->stack.reserve(256);
+    this->frames.reserve(64);
+}
+
+void VM::interpret(Program* program) {
+    try {
+        Compiler compiler;
+        this->module = compiler.compile(program);
+
+        this->globals.assign(this->module->globalNames.size(), Global());
+        this->globalFunctions.assign(this->module->globalFunctionNames.size(), nullptr);
+        this->stack.clear();
+        this->frames.clear();
+
+        this->call(this->module->functions[0].get(), 0, 0);
+        this->run();
+    } catch (const std::exception& e) {
+        OutputBuffer::instance().flush();
+        std::cerr << "[HATA] " << e.what() << std::endl;
+    }
+}
+
+void VM::call(FunctionProto* function, uint16_t argCount, size_t staticLink) {
+    if(argCount != function->paramTypes.size()) {
+        throw std::runtime_error("Fonksiyon çağrısında argüman sayısı uyuşmuyor. Beklenen: " +
+            std::to_string(function->paramTypes.size()) + ", Verilen: " +
+            std::to_string(argCount));
+    }
+
+    if(this->frames.size() >= FRAMES_MAX)
+        throw std::runtime_error("Yığın taşması: fonksiyon çağrıları çok derin.");
+
+    size_t base = this->stack.size() - argCount;
+
+    for(size_t i = 0; i < argCount; i++)
+        this->checkType(function->paramTypes[i], this->stack[base + i]);
+
+    this->frames.push_back({function, function->chunk.code.data(), base, staticLink});
+}
+
+// Argümanlar yığından okunur ve yerlerine sonuç konur, çerçeve açılmaz
+void VM::callBuiltin(const Builtin* builtin, uint16_t argCount) {
+    if(argCount != builtin->arity) {
+        throw std::runtime_error("Fonksiyon çağrısında argüman sayısı uyuşmuyor. Beklenen: " +
+            std::to_string(builtin->arity) + ", Verilen: " +
+            std::to_string(argCount));
+    }
+
+    size_t base = this->stack.size() - argCount;
+    Value result = builtin->function(this->stack.data() + base);
+    this->stack.resize(base);
+    this->push(result);
+}
+
+size_t VM::outerFrame(uint16_t hops) const {
+    size_t frame = this->frames.size() - 1;
+
+    while(hops-- > 0)
+        frame = this->frames[frame].staticLink;
+
+    return frame;
+}
+
+void VM::push(const Value& value) {
+    this->stack.push_back(value);
+}
+
+Value VM::pop() {
+    Value value = std::move(this->stack.back());
+    this->stack.pop_back();
+    return value;
+}
+
+Value& VM::peek(size_t distance) {
+    return this->stack[this->stack.size() - 1 - distance];
+}
+
+bool VM::isTruthy(const Value& value) const {
+    if(value.isNil())
+        return false;
+
+    if(value.isBool())
+        return value.asBool();
+
+    return true;
+}
+
+bool VM::isEqual(const Value& a, const Value& b) const {
+    if(a.isNil() && b.isNil())
+        return true;
+
+    if(a.isNil())
+        return false;
+
+    if(a.isBool() && b.isBool())
+        return a.asBool() == b.asBool();
+
+    if(a.isNumber() && b.isNumber())
+        return a.asNumber() == b.asNumber();
+
+    if(a.isString() && b.isString())
+        return a.asString() == b.asString();
+
+    return false;
+}
+
+void VM::checkNumberOperand(const Value& operand) const {
+    if(operand.isNumber())
+        return;
+
+    throw std::runtime_error("Operand sayı olmalıdır.");
+}
+
+void VM::checkNumberOperands(const Value& left, const Value& right) const {
+    if(left.isNumber() && right.isNumber())
+        return;
+
+    throw std::runtime_error("Operandlar sayı olmalıdır.");
+}
+
+void VM::checkType(TypeTag type, const Value& value) const {
+    switch(type) {
+    case TypeTag::NUMBER:
+        if(!value.isNumber())
+            throw std::runtime_error("Sayı tipindeki değişkene sayı olmayan bir değer atanamaz.");
+        break;
+    case TypeTag::STRING:
+        if(!value.isString())
+            throw std::runtime_error("Metin tipindeki değişkene metin olmayan bir değer atanamaz.");
+        break;
+    case TypeTag::BOOL:
+        if(!value.isBool())
+            throw std::runtime_error("Boolean tipindeki değişkene boolean olmayan bir değer atanamaz.");
+        break;
+    case TypeTag::ARRAY:
+        if(!value.isArray())
+            throw std::runtime_error("Dizi tipindeki değişkene dizi olmayan bir değer atanamaz.");
+        break;
+    }
+}
+
+void VM::checkAssignable(const Value& current, const Value& value, const std::string& name) const {
+    if(current.isNumber() && !value.isNumber())
+        throw std::runtime_error("Sayı tipindeki değişkene sayı olmayan bir değer atanamaz: " + name);
+    if(current.isString() && !value.isString())
+        throw std::runtime_error("Metin tipindeki değişkene metin olmayan bir değer atanamaz: " + name);
+    if(current.isBool() && !value.isBool())
+        throw std::runtime_error("Boolean tipindeki değişkene boolean olmayan bir değer atanamaz: " + name);
+    if(current.isArray() && !value.isArray())
+        throw std::runtime_error("Dizi tipindeki değişkene dizi olmayan bir değer atanamaz: " + name);
+}
+
+// Bileşik dizi atamasında elemana uygulanan işlem
+Value VM::arithmetic(OpCode op, const Value& left, const Value& right) const {
+    if(op == OpCode::ADD)
+        return this->add(left, right);
+
+    this->checkNumberOperands(left, right);
+
+    switch(op) {
+    case OpCode::SUBTRACT:
+        return Value(left.asNumber() - right.asNumber());
+    case OpCode::MULTIPLY:
+        return Value(left.asNumber() * right.asNumber());
+    case OpCode::DIVIDE:
+        if(right.asNumber() == 0)
+            throw std::runtime_error("Sıfıra bölme hatası.");
+        return Value(left.asNumber() / right.asNumber());
+    default:
+        throw std::runtime_error("Geçersiz ikili işlem.");
+    }
+}
+
+// Yığında [indeksler..., değer] bulunur. Eleman kök değerden başlanarak
+// referansla bulunur ve yerinde değiştirilir; paylaşılmayan dizi kopyalanmaz.
+void VM::storeIndex(Value& root, uint16_t count, uint16_t operation, const std::string& name) {
+    Value value = this->pop();
+    size_t first = this->stack.size() - count;
+    Value* container = &root;
+    size_t idx = 0;
+
+    for(size_t i = first; i < this->stack.size(); i++) {
+        const Value& index = this->stack[i];
+
+        if(!container->isArray())
+            throw std::runtime_error("Dizi olmayan bir değere atama yapılamaz.");
+
+        if(!index.isNumber())
+            throw std::runtime_error("Dizi indeksi sayı olmalıdır.");
+
+        int position = static_cast<int>(index.asNumber());
+        if(position < 0 || position >= static_cast<int>(container->arraySize()))
+            throw std::runtime_error("Dizi indeksi sınırlar dışında.");
+
+        idx = static_cast<size_t>(position);
+        if(i + 1 == this->stack.size())
+            break;
+
+        // Yoğun sayı dizisinin elemanları dizi olamaz
+        if(container->isNumberArray())
+            throw std::runtime_error("Dizi olmayan bir değere atama yapılamaz.");
+
+        container = &container->asMutableArray()[idx];
+    }
+
+    Value current = container->arrayAt(idx);
+    if(operation != 0)
+        value = this->arithmetic(static_cast<OpCode>(operation), current, value);
+
+    this->checkAssignable(current, value, name);
+    container->setArrayAt(idx, value);
+
+    this->stack.resize(first);
+    this->push(value);
+}
+
+Value VM::add(const Value& left, const Value& right) const {
+    if(left.isNumber() && right.isNumber())
+        return Value(left.asNumber() + right.asNumber());
+    if(Value::canConcat(left, right))
+        return Value::concat(left, right);
+
+    throw std::runtime_error("Operandlar sayı, metin veya doğruluk değeri olmalıdır.");
+}
+
+void VM::run() {
+    CallFrame* frame = &this->frames.back();
+    const uint8_t* ip = frame->ip;
+
+    #define READ_BYTE() (*ip++)
+    #define READ_SHORT() (ip += 2, static_cast<uint16_t>((ip[-2] << 8) | ip[-1]))
+    #define READ_CONSTANT() (frame->function->chunk.constants[READ_SHORT()])
+
+    while(true) {
+        switch(static_cast<OpCode>(READ_BYTE())) {
+        case OpCode::CONSTANT:
+            this->push(READ_CONSTANT());
+            break;
+        case OpCode::NIL:
+            this->push(Value());
+            break;
+        case OpCode::TRUE:
+            this->push(Value(true));
+            break;
+        case OpCode::FALSE:
+            this->push(Value(false));
+            break;
+        case OpCode::POP:
+            this->stack.pop_back();
+            break;
+        case OpCode::POP_N:
+            this->stack.resize(this->stack.size() - READ_SHORT());
+            break;
+
+        case OpCode::GET_LOCAL:
+            this->push(this->stack[frame->base + READ_SHORT()]);
+            break;
+        case OpCode::SET_LOCAL: {
+            Value& slot = this->stack[frame->base + READ_SHORT()];
+            const Value& name = READ_CONSTANT();
+            this->checkAssignable(slot, this->peek(), name.asString());
+            slot = this->peek();
+            break;
+        }
+        case OpCode::GET_OUTER: {
+            size_t outer = this->outerFrame(READ_SHORT());
+            this->push(this->stack[this->frames[outer].base + READ_SHORT()]);
+            break;
+        }
+        case OpCode::SET_OUTER: {
+            size_t outer = this->outerFrame(READ_SHORT());
+            Value& slot = this->stack[this->frames[outer].base + READ_SHORT()];
+            const Value& name = READ_CONSTANT();
+            this->checkAssignable(slot, this->peek(), name.asString());
+            slot = this->peek();
+            break;
+        }
+        case OpCode::GET_GLOBAL: {
+            uint16_t index = READ_SHORT();
+            const Global& global = this->globals[index];
+            if(!global.isDefined)
+                throw std::runtime_error("Tanımsız değişken: " + SymbolTable::instance().name(this->module->globalNames[index]));
+            this->push(global.value);
+            break;
+        }
+        case OpCode::SET_GLOBAL: {
+            uint16_t index = READ_SHORT();
+            Global& global = this->globals[index];
+            const std::string& name = SymbolTable::instance().name(this->module->globalNames[index]);
+            if(!global.isDefined)
+                throw std::runtime_error("Tanımsız değişken: " + name);
+            if(global.isConst)
+                throw std::runtime_error("Sabit bir değişkene değer atanamaz: " + name);
+            this->checkAssignable(global.value, this->peek(), name);
+            global.value = this->peek();
+            break;
+        }
+        case OpCode::DEFINE_GLOBAL: {
+            uint16_t index = READ_SHORT();
+            bool isConst = READ_SHORT() != 0;
+            Global& global = this->globals[index];
+            if(global.isDefined)
+                throw std::runtime_error("Bu isimde bir değişken zaten tanımlı: " + SymbolTable::instance().name(this->module->globalNames[index]));
+            global.value = this->pop();
+            global.isDefined = true;
+            global.isConst = isConst;
+            break;
+        }
+        case OpCode::DEFINE_FUNCTION: {
+            uint16_t index = READ_SHORT();
+            this->globalFunctions[index] = this->module->functions[READ_SHORT()].get();
+            break;
+        }
+        case OpCode::CHECK_TYPE:
+            this->checkType(static_cast<TypeTag>(READ_SHORT()), this->peek());
+            break;
+        case OpCode::CHECK_RETURN: {
+            TypeTag type = static_cast<TypeTag>(READ_SHORT());
+            const Value& value = this->peek();
+            if(type == TypeTag::NUMBER && !value.isNumber())
+                throw std::runtime_error("Fonksiyon sayı tipinde değer döndürmeli.");
+            if(type == TypeTag::STRING && !value.isString())
+                throw std::runtime_error("Fonksiyon metin tipinde değer döndürmeli.");
+            if(type == TypeTag::BOOL && !value.isBool())
+                throw std::runtime_error("Fonksiyon doğruluk tipinde değer döndürmeli.");
+            break;
+        }
+
+        case OpCode::ADD: {
+            Value right = this->pop();
+            Value& left = this->peek();
+            left = this->add(left, right);
+            break;
+        }
+        case OpCode::SUBTRACT: {
+            Value right = this->pop();
+            Value& left = this->peek();
+            this->checkNumberOperands(left, right);
+            left = Value(left.asNumber() - right.asNumber());
+            break;
+        }
+        case OpCode::MULTIPLY: {
+            Value right = this->pop();
+            Value& left = this->peek();
+            this->checkNumberOperands(left, right);
+            left = Value(left.asNumber() * right.asNumber());
+            break;
+        }
+        case OpCode::DIVIDE: {
+            Value right = this->pop();
+            Value& left = this->peek();
+            this->checkNumberOperands(left, right);
+            if(right.asNumber() == 0)
+                throw std::runtime_error("Sıfıra bölme hatası.");
+            left = Value(left.asNumber() / right.asNumber());
+            break;
+        }
+        case OpCode::MODULUS: {
+            Value right = this->pop();
+            Value& left = this->peek();
+            this->checkNumberOperands(left, right);
+            if(right.asNumber() == 0)
+                throw std::runtime_error("Sıfıra bölme hatası.");
+            left = Value(fmod(left.asNumber(), right.asNumber()));
+            break;
+        }
+        case OpCode::POWER: {
+            Value right = this->pop();
+            Value& left = this->peek();
+            this->checkNumberOperands(left, right);
+            left = Value(pow(left.asNumber(), right.asNumber()));
+            break;
+        }
+        case OpCode::NEGATE: {
+            Value& operand = this->peek();
+            this->checkNumberOperand(operand);
+            operand = Value(-operand.asNumber());
+            break;
+        }
+        case OpCode::NOT: {
+            Value& operand = this->peek();
+            operand = Value(!this->isTruthy(operand));
+            break;
+        }
+
+        case OpCode::EQUAL: {
+            Value right = this->pop();
+            Value& left = this->peek();
+            left = Value(this->isEqual(left, right));
+            break;
+        }
+        case OpCode::NOT_EQUAL: {
+            Value right = this->pop();
+            Value& left = this->peek();
+            left = Value(!this->isEqual(left, right));
+            break;
+        }
+        case OpCode::GREAT: {
+            Value right = this->pop();
+            Value& left = this->peek();
+            this->checkNumberOperands(left, right);
+            left = Value(left.asNumber() > right.asNumber());
+            break;
+        }
+        case OpCode::GREAT_EQUAL: {
+            Value right = this->pop();
+            Value& left = this->peek();
+            this->checkNumberOperands(left, right);
+            left = Value(left.asNumber() >= right.asNumber());
+            break;
+        }
+        case OpCode::LESS: {
+            Value right = this->pop();
+            Value& left = this->peek();
+            this->checkNumberOperands(left, right);
+            left = Value(left.asNumber() < right.asNumber());
+            break;
+        }
+        case OpCode::LESS_EQUAL: {
+            Value right = this->pop();
+            Value& left = this->peek();
+            this->checkNumberOperands(left, right);
+            left = Value(left.asNumber() <= right.asNumber());
+            break;
+        }
+
+        case OpCode::JUMP: {
+            uint16_t offset = READ_SHORT();
+            ip += offset;
+            break;
+        }
+        case OpCode::JUMP_IF_FALSE: {
+            uint16_t offset = READ_SHORT();
+            if(!this->isTruthy(this->peek()))
+                ip += offset;
+            this->stack.pop_back();
+            break;
+        }
+        case OpCode::JUMP_IF_FALSE_OR_POP: {
+            uint16_t offset = READ_SHORT();
+            if(!this->isTruthy(this->peek()))
+                ip += offset;
+            else
+                this->stack.pop_back();
+            break;
+        }
+        case OpCode::JUMP_IF_TRUE_OR_POP: {
+            uint16_t offset = READ_SHORT();
+            if(this->isTruthy(this->peek()))
+                ip += offset;
+            else
+                this->stack.pop_back();
+            break;
+        }
+        case OpCode::LOOP: {
+            uint16_t offset = READ_SHORT();
+            ip -= offset;
+            break;
+        }
+
+        case OpCode::CALL: {
+            FunctionProto* function = this->module->functions[READ_SHORT()].get();
+            uint16_t argCount = READ_SHORT();
+            // Çağrılan fonksiyonun tanımlandığı fonksiyonun çerçevesi
+            size_t staticLink = this->outerFrame(static_cast<uint16_t>(frame->function->depth - (function->depth - 1)));
+            frame->ip = ip;
+            this->call(function, argCount, staticLink);
+            frame = &this->frames.back();
+            ip = frame->ip;
+            break;
+        }
+        case OpCode::CALL_GLOBAL: {
+            uint16_t index = READ_SHORT();
+            uint16_t argCount = READ_SHORT();
+            FunctionProto* function = this->globalFunctions[index];
+            if(function == nullptr) {
+                const Builtin* builtin = this->module->globalBuiltins[index];
+                if(builtin == nullptr)
+                    throw std::runtime_error("Tanımsız fonksiyon: " + SymbolTable::instance().name(this->module->globalFunctionNames[index]));
+                this->callBuiltin(builtin, argCount);
+                break;
+            }
+            frame->ip = ip;
+            this->call(function, argCount, 0);
+            frame = &this->frames.back();
+            ip = frame->ip;
+            break;
+        }
+        case OpCode::RETURN: {
+            Value result = this->pop();
+            size_t base = frame->base;
+            this->frames.pop_back();
+
+            if(this->frames.empty())
+                return;
+
+            this->stack.resize(base);
+            this->push(result);
+            frame = &this->frames.back();
+            ip = frame->ip;
+            break;
+        }
+
+        case OpCode::ARRAY: {
+            uint16_t count = READ_SHORT();
+            std::vector<Value> elements(this->stack.end() - count, this->stack.end());
+            this->stack.resize(this->stack.size() - count);
+            this->push(Value::array(std::move(elements)));
+            break;
+        }
+        case OpCode::INDEX: {
+            Value index = this->pop();
+            Value array = this->pop();
+
+            if(!array.isArray())
+                throw std::runtime_error("Dizi olmayan bir değere erişim yapılamaz.");
+
+            if(!index.isNumber())
+                throw std::runtime_error("Dizi indeksi sayı olmalıdır.");
+
+            int idx = static_cast<int>(index.asNumber());
+
+            if(idx < 0 || idx >= static_cast<int>(array.arraySize()))
+                throw std::runtime_error("Dizi indeksi sınırlar dışında.");
+
+            this->push(array.arrayAt(idx));
+            break;
+        }
+        case OpCode::SET_INDEX_LOCAL: {
+            Value& root = this->stack[frame->base + READ_SHORT()];
+            uint16_t count = READ_SHORT();
+            uint16_t operation = READ_SHORT();
+            const Value& name = READ_CONSTANT();
+            this->storeIndex(root, count, operation, name.asString());
+            break;
+        }
+        case OpCode::SET_INDEX_OUTER: {
+            size_t outer = this->outerFrame(READ_SHORT());
+            Value& root = this->stack[this->frames[outer].base + READ_SHORT()];
+            uint16_t count = READ_SHORT();
+            uint16_t operation = READ_SHORT();
+            const Value& name = READ_CONSTANT();
+            this->storeIndex(root, count, operation, name.asString());
+            break;
+        }
+        case OpCode::SET_INDEX_GLOBAL: {
+            uint16_t index = READ_SHORT();
+            uint16_t count = READ_SHORT();
+            uint16_t operation = READ_SHORT();
+            Global& global = this->globals[index];
+            const std::string& name = SymbolTable::instance().name(this->module->globalNames[index]);
+            if(!global.isDefined)
+                throw std::runtime_error("Tanımsız değişken: " + name);
+            if(global.isConst)
+                throw std::runtime_error("Sabit bir değişkene değer atanamaz: " + name);
+            this->storeIndex(global.value, count, operation, name);
+            break;
+        }
+        case OpCode::PRINT:
+            OutputBuffer::instance().printLine(this->pop());
+            break;
+        case OpCode::ERROR:
+            throw std::runtime_error(READ_CONSTANT().asString());
+        }
+    }
+
+    #undef READ_BYTE
+    #undef READ_SHORT
+    #undef READ_CONSTANT
+}
@@ -0,0 +1,58 @@
+#ifndef VM_HPP
+#define VM_HPP
+
+#include <memory>
+#include <string>
+#include <vector>
+#include "../ast/ast.hpp"
+#include "chunk.hpp"
+
+// Compiler'ın ürettiği bayt kodunu çalıştıran yığın tabanlı sanal makine
+class VM {
+public:
+    VM();
+    void interpret(Program* program);
+
+private:
+    struct CallFrame {
+        FunctionProto* function;
+        const uint8_t* ip;
+        size_t base;       // Fonksiyonun ilk yerel değişkeninin yığındaki yeri
+        size_t staticLink; // Sözcüksel olarak kapsayan fonksiyonun çerçevesi
+    };
+
+    struct Global {
+        Value value;
+        bool isDefined = false;
+        bool isConst = false;
+    };
+
+    static constexpr size_t FRAMES_MAX = 10000;
+
+    std::unique_ptr<Module> module;
+    std::vector<Global> globals;
+    std::vector<FunctionProto*> globalFunctions;
+    std::vector<Value> stack;
+    std::vector<CallFrame> frames;
+
+    void run();
+    void call(FunctionProto* function, uint16_t argCount, size_t staticLink);
+    void callBuiltin(const Builtin* builtin, uint16_t argCount);
+    size_t outerFrame(uint16_t hops) const;
+
+    void push(const Value& value);
+    Value pop();
+    Value& peek(size_t distance = 0);
+
+    bool isTruthy(const Value& value) const;
+    bool isEqual(const Value& a, const Value& b) const;
+    void checkNumberOperand(const Value& operand) const;
+    void checkNumberOperands(const Value& left, const Value& right) const;
+    void checkType(TypeTag type, const Value& value) const;
+    void checkAssignable(const Value& current, const Value& value, const std::string& name) const;
+    Value add(const Value& left, const Value& right) const;
+    Value arithmetic(OpCode op, const Value& left, const Value& right) const;
+    void storeIndex(Value& root, uint16_t count, uint16_t operation, const std::string& name);
+};
+
+#endif // VM_HPP